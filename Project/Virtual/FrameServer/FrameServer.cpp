@@ -0,0 +1,310 @@
+//*******************************************************************
+/*!
+\file   FrameServer.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Stand-in server for DisplayGraphic_VirtualFrame
+*/
+
+//*******************************************************************
+/*
+Usage:    FrameServer [-p port] [-o image.ppm] [-n frames]
+
+          Receives the batched frames of DisplayGraphic_VirtualFrame,
+          decodes them into a local framebuffer and prints the frame rate
+          and transfer statistics once per second. With -o the framebuffer
+          is written as PPM image after every n-th frame and at disconnect,
+          e.g. for comparison in CI runs.
+
+Build:    Linux:   g++ -O2 -o FrameServer FrameServer.cpp
+          Windows: g++ -O2 -o FrameServer FrameServer.cpp -lws2_32
+*/
+
+//*******************************************************************
+#ifdef _WIN32
+  #include <winsock2.h>
+  typedef int socklen_t;
+#else
+  #include <sys/socket.h>
+  #include <netinet/in.h>
+  #include <unistd.h>
+  #define closesocket close
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//*******************************************************************
+typedef unsigned char  BYTE;
+typedef unsigned short WORD;
+typedef unsigned int   DWORD;
+
+//*******************************************************************
+static const DWORD MAGIC = 0x314D5246; // 'FRM1'
+static const WORD  RLE   = 0x8000;
+
+//*******************************************************************
+class FrameServer
+{
+  public:
+    //---------------------------------------------------------------
+    FrameServer( const char *imageFileIn, DWORD imageEveryIn )
+    {
+      imageFile  = imageFileIn;
+      imageEvery = imageEveryIn;
+      width      = 0;
+      height     = 0;
+      frame      = 0;
+      payload    = 0;
+      payloadMax = 0;
+    }
+
+    //---------------------------------------------------------------
+    // Handle one client until it disconnects
+    void run( int sock )
+    {
+      BYTE  header[20];
+      DWORD frames = 0;
+      DWORD bytes  = 0;
+      DWORD spans  = 0;
+      time_t last  = time( 0 );
+
+      while( receive( sock, header, sizeof(header) ) )
+      {
+        if( getDWord( header ) != MAGIC )
+        {
+          fprintf( stderr, "FrameServer: wrong magic, closing\n" );
+          break;
+        }
+
+        WORD  w           = getWord ( header +  4 );
+        WORD  h           = getWord ( header +  6 );
+        DWORD frameNo     = getDWord( header +  8 );
+        WORD  numOfSpans  = getWord ( header + 12 );
+        DWORD payloadSize = getDWord( header + 16 );
+
+        resize( w, h, payloadSize );
+
+        if( !receive( sock, payload, payloadSize ) || !decode( numOfSpans, payloadSize ) )
+        {
+          fprintf( stderr, "FrameServer: corrupt frame %u\n", frameNo );
+          break;
+        }
+
+        frames++;
+        spans += numOfSpans;
+        bytes += sizeof(header) + payloadSize;
+
+        if( imageFile && imageEvery && frameNo % imageEvery == 0 )
+        {
+          writeImage();
+        }
+
+        if( time( 0 ) != last )
+        {
+          printf( "frames/s:%5u  kByte/s:%7.1f  spans/frame:%5u  (raw frame: %u kByte)\n",
+                  frames, bytes/1024.0, spans/frames, w*h*2/1024 );
+          fflush( stdout );
+          frames = bytes = spans = 0;
+          last   = time( 0 );
+        }
+      }
+
+      if( imageFile )
+      {
+        writeImage();
+      }
+    }
+
+  private:
+    //---------------------------------------------------------------
+    void resize( WORD w, WORD h, DWORD payloadSize )
+    {
+      if( w != width || h != height )
+      {
+        delete[] frame;
+        width  = w;
+        height = h;
+        frame  = new WORD[ (DWORD)w * h ];
+        memset( frame, 0, (DWORD)w * h * sizeof(WORD) );
+      }
+      if( payloadSize > payloadMax )
+      {
+        delete[] payload;
+        payloadMax = payloadSize;
+        payload    = new BYTE[ payloadMax ];
+      }
+    }
+
+    //---------------------------------------------------------------
+    bool decode( WORD numOfSpans, DWORD size )
+    {
+      DWORD pos = 0;
+
+      for( WORD s = 0; s < numOfSpans; s++ )
+      {
+        if( pos + 6 > size )
+        {
+          return( false );
+        }
+        WORD y   = getWord( payload + pos     );
+        WORD x   = getWord( payload + pos + 2 );
+        WORD w   = getWord( payload + pos + 4 );
+        bool rle = w & RLE;
+
+        w   &= ~RLE;
+        pos += 6;
+
+        if( y >= height || x + w > width )
+        {
+          return( false );
+        }
+        WORD *dst = &frame[ (DWORD)y * width + x ];
+
+        for( WORD i = 0; i < w; )
+        {
+          if( !rle )
+          {
+            if( pos + 2 > size ) return( false );
+            dst[i++] = getWord( payload + pos );
+            pos += 2;
+            continue;
+          }
+
+          if( pos + 2 > size ) return( false );
+          WORD token = getWord( payload + pos );
+          WORD n     = token & ~RLE;
+          pos += 2;
+
+          if( i + n > w ) return( false );
+
+          if( token & RLE )
+          {
+            if( pos + 2 > size ) return( false );
+            WORD color = getWord( payload + pos );
+            pos += 2;
+            while( n-- )
+            {
+              dst[i++] = color;
+            }
+          }
+          else
+          {
+            if( pos + 2*n > size ) return( false );
+            while( n-- )
+            {
+              dst[i++] = getWord( payload + pos );
+              pos += 2;
+            }
+          }
+        }
+      }
+      return( pos == size );
+    }
+
+    //---------------------------------------------------------------
+    void writeImage( void )
+    {
+      FILE *f = fopen( imageFile, "wb" );
+      if( !f || !frame )
+      {
+        if( f ) fclose( f );
+        return;
+      }
+      fprintf( f, "P6\n%u %u\n255\n", width, height );
+      for( DWORD i = 0; i < (DWORD)width * height; i++ )
+      {
+        WORD c = frame[i];
+        BYTE rgb[3] = { (BYTE)((c >> 8) & 0xF8),   // rrrrr gggggg bbbbb
+                        (BYTE)((c >> 3) & 0xFC),
+                        (BYTE)((c << 3) & 0xF8) };
+        fwrite( rgb, 1, 3, f );
+      }
+      fclose( f );
+    }
+
+    //---------------------------------------------------------------
+    static bool receive( int sock, BYTE *data, DWORD size )
+    {
+      for( DWORD n = 0; n < size; )
+      {
+        int ret = recv( sock, (char *)data + n, size - n, 0 );
+        if( ret <= 0 )
+        {
+          return( false );
+        }
+        n += ret;
+      }
+      return( true );
+    }
+
+    //---------------------------------------------------------------
+    static WORD  getWord ( const BYTE *p ) { return( p[0] | (p[1] << 8) ); }
+    static DWORD getDWord( const BYTE *p ) { return( getWord( p ) | ((DWORD)getWord( p + 2 ) << 16) ); }
+
+  private:
+    //---------------------------------------------------------------
+    const char *imageFile;
+    DWORD       imageEvery;
+    WORD        width;
+    WORD        height;
+    WORD       *frame;
+    BYTE       *payload;
+    DWORD       payloadMax;
+};
+
+//*******************************************************************
+int main( int argc, char *argv[] )
+{
+  int         port       = 1001;
+  const char *imageFile  = 0;
+  DWORD       imageEvery = 0;
+
+  for( int i = 1; i + 1 < argc; i += 2 )
+  {
+    if     ( !strcmp( argv[i], "-p" ) ) port       = atoi( argv[i+1] );
+    else if( !strcmp( argv[i], "-o" ) ) imageFile  =       argv[i+1];
+    else if( !strcmp( argv[i], "-n" ) ) imageEvery = atoi( argv[i+1] );
+  }
+
+  #ifdef _WIN32
+    WSADATA wsaData;
+    WSAStartup( MAKEWORD( 2, 2 ), &wsaData );
+  #endif
+
+  int listener = socket( AF_INET, SOCK_STREAM, 0 );
+  int on       = 1;
+  setsockopt( listener, SOL_SOCKET, SO_REUSEADDR, (const char *)&on, sizeof(on) );
+
+  struct sockaddr_in addr;
+  memset( &addr, 0, sizeof(addr) );
+  addr.sin_family      = AF_INET;
+  addr.sin_port        = htons( port );
+  addr.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+
+  if(    bind( listener, (struct sockaddr *)&addr, sizeof(addr) ) < 0
+      || listen( listener, 1 ) < 0 )
+  {
+    fprintf( stderr, "FrameServer: can't listen on port %d\n", port );
+    return( 1 );
+  }
+  printf( "FrameServer: listening on localhost:%d\n", port );
+
+  FrameServer server( imageFile, imageEvery );
+
+  while( 1 )
+  {
+    int client = accept( listener, 0, 0 );
+    if( client < 0 )
+    {
+      continue;
+    }
+    printf( "FrameServer: client connected\n" );
+    server.run( client );
+    closesocket( client );
+    printf( "FrameServer: client disconnected\n" );
+  }
+}
+
+//EOF
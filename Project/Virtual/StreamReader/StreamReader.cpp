@@ -0,0 +1,1023 @@
+//*******************************************************************
+/*!
+\file   StreamReader.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Host reader and recorder of the vendor bulk sample stream
+*/
+
+//*******************************************************************
+/*
+Usage:    StreamReader [-n transfers] [-t seconds] [-o file] [-l rate] [-c coding]
+
+          Opens the scope (vendor bulk interface, see
+          Src/Scope/BulkLink/descriptor.txt), starts the stream and reads
+          the frames with n asynchronous bulk transfers in flight (default
+          8), so the endpoint is never idle while a frame is processed.
+          The sequence numbers and header checksums are checked, frames
+          with coded samples (delta and Rice code, see Src/Scope/Rice.h)
+          are decoded. The frame rate, data rate, compression ratio and
+          lost frames are printed once per second. Runs for t seconds or until Ctrl-C, then stops the
+          stream.
+
+          With -o the samples are recorded into a capture file (see
+          below). The file is written by a separate thread, so a slow
+          disk never stalls the USB transfers. If all buffers of the
+          writer are in use, frames are discarded and counted as
+          overrun.
+
+          With -l no device is opened. The frames are generated by a
+          loopback stand-in for the device at the given sample rate
+          (0: as fast as possible), with a sine on channel A and a square
+          wave on channel B, both 16 bit codes like the ADC of the device.
+          The samples are coded like on the device (-c 1: delta and Rice
+          code, default) or raw (-c 0). Every 1000th frame is skipped,
+          like a block dropped by the device, to exercise the gap
+          handling.
+
+          USBhost_Mcu only offers blocking control and interrupt
+          transfers, so the same libusb is used directly here.
+
+Build:    Linux:   g++ -O2 -pthread -o StreamReader StreamReader.cpp -lusb-1.0
+          Windows: g++ -O2 -o StreamReader StreamReader.cpp -lusb-1.0
+                   (WinUSB is bound by the compat id of the descriptor)
+
+Capture file (little endian):
+
+          The file is a sequence of chunks, appended only. A chunk holds
+          the samples of consecutive frames, interleaved like the frame
+          (A, B, A, B, ...). It is padded to a multiple of ALIGN bytes and
+          at most CHUNK_SIZE bytes long. A gap of the sequence numbers, a
+          change of the channels or of the sample rate starts a new chunk.
+
+          Chunk header (32 Byte):
+            DWORD magic         'SCHK'
+            BYTE  version       1
+            BYTE  channelMask   1: A, 2: B, 3: A and B
+            WORD  reserved
+            DWORD sampleRate    [Hz]
+            DWORD numOfSamples  per channel
+            DWORD firstSample   lo
+            DWORD firstSample   hi (sample number since start of stream)
+            DWORD dataSize      [Byte], samples only
+            DWORD size          [Byte], header, samples and padding
+
+          Index <file>.idx, one entry (16 Byte) per chunk, ascending:
+            DWORD firstSample   lo
+            DWORD firstSample   hi
+            DWORD fileOffset    lo
+            DWORD fileOffset    hi
+
+          To seek a sample number, search the index for the last entry
+          with firstSample <= sample and add the position of the sample
+          within the chunk. A sample missing in every chunk was lost.
+          The index can be rebuilt by following the chunk sizes.
+*/
+
+//*******************************************************************
+#include <libusb-1.0/libusb.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+//*******************************************************************
+typedef unsigned char      BYTE;
+typedef unsigned short     WORD;
+typedef unsigned int       DWORD;
+typedef unsigned long long QWORD;
+
+//*******************************************************************
+// see Src/Scope/Stream.h and Src/Scope/BulkLink.h
+static const WORD  VID           = 0x0025;
+static const WORD  PID           = 0x3008;
+static const BYTE  EP_IN         = 0x81;
+static const BYTE  EP_OUT        = 0x02;
+static const BYTE  CMD_STOP      = 0;
+static const BYTE  CMD_START     = 1;
+static const WORD  SYNC          = 0x5353;
+static const BYTE  VERSION       = 2;
+static const DWORD HEADER_SIZE   = 24;
+static const BYTE  CODING_RAW    = 0;
+static const BYTE  CODING_RICE   = 1;
+static const BYTE  RICE_RAW      = 0xFF;  // see Src/Scope/Rice.h
+static const BYTE  RICE_K_MAX    = 15;
+static const BYTE  RICE_Q_MAX    = 16;
+static const WORD  BLOCK_SIZE    = 256;
+static const DWORD TRANSFER_SIZE = 4096;  // > one frame, a short packet ends a frame
+static const int   MAX_TRANSFERS = 64;
+
+static volatile bool isRunning = true;
+
+//*******************************************************************
+static WORD  getWord ( const BYTE *p ) { return( p[0] | (p[1] << 8) ); }
+static DWORD getDWord( const BYTE *p ) { return( getWord( p ) | ((DWORD)getWord( p + 2 ) << 16) ); }
+
+static void  setWord ( BYTE *p, WORD  x ) { p[0] = x; p[1] = x >> 8; }
+static void  setDWord( BYTE *p, DWORD x ) { setWord( p, x ); setWord( p + 2, x >> 16 ); }
+static void  setQWord( BYTE *p, QWORD x ) { setDWord( p, (DWORD)x ); setDWord( p + 4, (DWORD)(x >> 32) ); }
+
+//-------------------------------------------------------------------
+// Sum of the WORDs of a frame header before the checksum
+static WORD checksum( const BYTE *header )
+{
+  WORD sum = 0;
+  for( DWORD i = 0; i < HEADER_SIZE - 2; i += 2 )
+  {
+    sum += getWord( header + i );
+  }
+  return( sum );
+}
+
+//-------------------------------------------------------------------
+// Decode the samples of one channel (see Src/Scope/Rice.h) into every
+// stride-th WORD of sample. The time is linear in n, even for
+// corrupt data. Returns the end of the data of the channel or 0.
+static const BYTE *decodeRice( const BYTE *p, const BYTE *end,
+                               BYTE *sample, DWORD n, DWORD stride )
+{
+  if( p >= end )
+  {
+    return( 0 );
+  }
+
+  BYTE k = *p++;
+
+  if( k == RICE_RAW )
+  {
+    if( (DWORD)( end - p ) < 2 * n )
+    {
+      return( 0 );
+    }
+    for( DWORD i = 0; i < n; i++ )
+    {
+      setWord( sample + 2 * i * stride, getWord( p + 2 * i ) );
+    }
+    return( p + 2 * n );
+  }
+
+  if( k > RICE_K_MAX || n == 0 || end - p < 2 )
+  {
+    return( 0 );
+  }
+
+  WORD x = getWord( p );
+  p += 2;
+  setWord( sample, x );
+
+  QWORD bitBuf = 0;
+  DWORD bitCnt = 0;
+
+  for( DWORD i = 1; i < n; i++ )
+  {
+    // a code has at most 32 bits
+    while( bitCnt <= 56 && p < end )
+    {
+      bitBuf |= (QWORD)*p++ << bitCnt;
+      bitCnt += 8;
+    }
+
+    DWORD q = 0;
+    while( q < RICE_Q_MAX && ( ( bitBuf >> q ) & 1 ) )
+    {
+      q++;
+    }
+
+    WORD  u;
+    DWORD len;
+    if( q < RICE_Q_MAX )
+    {
+      len = q + 1 + k;
+      u   = ( q << k ) | ( ( bitBuf >> ( q + 1 ) ) & ( ( 1 << k ) - 1 ) );
+    }
+    else
+    {
+      len = RICE_Q_MAX + 16;
+      u   = bitBuf >> RICE_Q_MAX;
+    }
+    if( len > bitCnt )
+    {
+      return( 0 );
+    }
+    bitBuf >>= len;
+    bitCnt  -= len;
+
+    // unsigned back to the difference, modulo 2^16
+    x += ( u >> 1 ) ^ ( ( u & 1 ) ? 0xFFFF : 0 );
+    setWord( sample + 2 * i * stride, x );
+  }
+
+  // the rest of the last byte is padding
+  return( p - bitCnt / 8 );
+}
+
+//-------------------------------------------------------------------
+// Difference of sample i to the one before, mapped to unsigned
+static WORD riceResidual( const WORD *sample, DWORD i, DWORD stride )
+{
+  WORD d = sample[ i * stride ] - sample[ ( i - 1 ) * stride ];
+
+  return( ( d << 1 ) ^ ( ( d & 0x8000 ) ? 0xFFFF : 0 ) );
+}
+
+//-------------------------------------------------------------------
+// Number of bits of the code of u
+static DWORD riceBits( WORD u, BYTE k )
+{
+  return( ( ( u >> k ) < RICE_Q_MAX ) ? ( u >> k ) + 1 + k : RICE_Q_MAX + 16 );
+}
+
+//-------------------------------------------------------------------
+// Encode every stride-th WORD of sample like Rice::encode() of the
+// device (see Src/Scope/Rice.cpp), for the loopback. Returns the size.
+static DWORD encodeRice( const WORD *sample, DWORD n, DWORD stride, BYTE *out )
+{
+  BYTE  k     = 0;
+  DWORD total = 0;
+
+  if( n >= 2 )
+  {
+    DWORD sum = 0;
+    for( DWORD i = 1; i < n; i++ )
+    {
+      sum += riceResidual( sample, i, stride );
+    }
+    DWORD mean = sum / ( n - 1 );
+    while( k < RICE_K_MAX && ( 2UL << k ) <= mean )
+    {
+      k++;
+    }
+
+    // exact size of k - 1, k and k + 1
+    BYTE  kTry[3] = { (BYTE)( k > 0 ? k - 1 : 0 ), k, (BYTE)( k < RICE_K_MAX ? k + 1 : RICE_K_MAX ) };
+    DWORD size[3] = { 0, 0, 0 };
+    for( DWORD i = 1; i < n; i++ )
+    {
+      for( int j = 0; j < 3; j++ )
+      {
+        size[j] += riceBits( riceResidual( sample, i, stride ), kTry[j] );
+      }
+    }
+    int best = 0;
+    for( int j = 1; j < 3; j++ )
+    {
+      if( size[j] < size[best] )
+      {
+        best = j;
+      }
+    }
+    k     = kTry[best];
+    total = size[best];
+  }
+
+  if( n < 2 || 3 + ( total + 7 ) / 8 >= 1 + 2 * n )
+  {
+    // the code does not pay off
+    out[0] = RICE_RAW;
+    for( DWORD i = 0; i < n; i++ )
+    {
+      setWord( out + 1 + 2 * i, sample[ i * stride ] );
+    }
+    return( 1 + 2 * n );
+  }
+
+  out[0] = k;
+  setWord( out + 1, sample[0] );
+
+  BYTE  *p      = out + 3;
+  QWORD  bitBuf = 0;
+  DWORD  bitCnt = 0;
+
+  for( DWORD i = 1; i < n; i++ )
+  {
+    WORD u = riceResidual( sample, i, stride );
+    WORD q = u >> k;
+
+    if( q < RICE_Q_MAX )
+    {
+      // q one bits and a zero bit, then the low bits
+      bitBuf |= (QWORD)( ( 1 << q ) - 1 ) << bitCnt;
+      bitBuf |= (QWORD)( u & ( ( 1 << k ) - 1 ) ) << ( bitCnt + q + 1 );
+      bitCnt += q + 1 + k;
+    }
+    else
+    {
+      // escape
+      bitBuf |= (QWORD)0xFFFF << bitCnt;
+      bitBuf |= (QWORD)u << ( bitCnt + RICE_Q_MAX );
+      bitCnt += RICE_Q_MAX + 16;
+    }
+    while( bitCnt >= 8 ) { *p++ = bitBuf; bitBuf >>= 8; bitCnt -= 8; }
+  }
+  if( bitCnt > 0 )
+  {
+    *p++ = bitBuf;
+  }
+  return( p - out );
+}
+
+//*******************************************************************
+class CaptureFile
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      MAGIC          = 0x4B484353, // 'SCHK'
+      VERSION        = 1,          // of the chunk, not of the stream
+      CHUNK_HEADER   = 32,
+      CHUNK_SIZE     = 1 << 20,    // one write per chunk
+      ALIGN          = 4096,       // size and address of the writes
+      NUM_OF_BUFFERS = 16          // 16 MByte to bridge disk stalls
+    };
+
+  public:
+    //---------------------------------------------------------------
+    CaptureFile( void )
+    {
+      file     = 0;
+      index    = 0;
+      offset   = 0;
+      current  = 0;
+      overruns = 0;
+      chunks   = 0;
+      isOpen   = false;
+
+      for( int i = 0; i < NUM_OF_BUFFERS; i++ )
+      {
+        chunk[i].data = (BYTE *)allocAligned( CHUNK_SIZE );
+        freeList.push_back( &chunk[i] );
+      }
+    }
+
+    //---------------------------------------------------------------
+    ~CaptureFile( void )
+    {
+      close();
+      for( int i = 0; i < NUM_OF_BUFFERS; i++ )
+      {
+        freeAligned( chunk[i].data );
+      }
+    }
+
+    //---------------------------------------------------------------
+    bool open( const char *name )
+    {
+      char indexName[1024];
+
+      snprintf( indexName, sizeof(indexName), "%s.idx", name );
+
+      file  = fopen( name,      "wb" );
+      index = fopen( indexName, "wb" );
+      if( !file || !index )
+      {
+        return( false );
+      }
+      // the chunks are already large and aligned, no copy into a stdio buffer
+      setvbuf( file, 0, _IONBF, 0 );
+
+      isOpen = true;
+      writer = std::thread( &CaptureFile::write, this );
+      return( true );
+    }
+
+    //---------------------------------------------------------------
+    // Write the last chunk and wait for the writer
+    void close( void )
+    {
+      if( !isOpen )
+      {
+        return;
+      }
+      flush();
+      {
+        std::lock_guard<std::mutex> lock( mutex );
+        isOpen = false;
+      }
+      cond.notify_one();
+      writer.join();
+
+      fclose( file );
+      fclose( index );
+    }
+
+    //---------------------------------------------------------------
+    // Append the samples of a frame. Called by the reader, never
+    // waits for the disk
+    void add( const BYTE *data, DWORD size,
+              QWORD firstSample, WORD numOfSamples,
+              BYTE channelMask, DWORD sampleRate )
+    {
+      if(    current
+          && (    current->channelMask != channelMask
+               || current->sampleRate  != sampleRate
+               || current->firstSample + current->numOfSamples != firstSample
+               || current->used + size > CHUNK_SIZE ) )
+      {
+        flush();
+      }
+
+      if( !current )
+      {
+        std::lock_guard<std::mutex> lock( mutex );
+        if( freeList.empty() )
+        {
+          overruns++;
+          return;
+        }
+        current = freeList.back();
+        freeList.pop_back();
+
+        current->used         = CHUNK_HEADER;
+        current->firstSample  = firstSample;
+        current->numOfSamples = 0;
+        current->channelMask  = channelMask;
+        current->sampleRate   = sampleRate;
+      }
+
+      memcpy( current->data + current->used, data, size );
+      current->used         += size;
+      current->numOfSamples += numOfSamples;
+    }
+
+    //---------------------------------------------------------------
+    DWORD getOverruns( void ) const { return( overruns ); }
+    DWORD getChunks  ( void ) const { return( chunks   ); }
+
+  private:
+    //---------------------------------------------------------------
+    class Chunk
+    {
+      public:
+        BYTE  *data;
+        DWORD  used;
+        DWORD  size;
+        QWORD  firstSample;
+        DWORD  numOfSamples;
+        BYTE   channelMask;
+        DWORD  sampleRate;
+    };
+
+    //---------------------------------------------------------------
+    // Complete the header and padding, pass the chunk to the writer
+    void flush( void )
+    {
+      if( !current )
+      {
+        return;
+      }
+      Chunk *c = current;
+      BYTE  *h = c->data;
+
+      c->size = ( c->used + ALIGN - 1 ) & ~(DWORD)( ALIGN - 1 );
+      memset( c->data + c->used, 0, c->size - c->used );
+
+      setDWord( h +  0, MAGIC );
+      h[4] = VERSION;
+      h[5] = c->channelMask;
+      setWord ( h +  6, 0 );
+      setDWord( h +  8, c->sampleRate );
+      setDWord( h + 12, c->numOfSamples );
+      setQWord( h + 16, c->firstSample );
+      setDWord( h + 24, c->used - CHUNK_HEADER );
+      setDWord( h + 28, c->size );
+
+      current = 0;
+      {
+        std::lock_guard<std::mutex> lock( mutex );
+        fullList.push_back( c );
+      }
+      cond.notify_one();
+    }
+
+    //---------------------------------------------------------------
+    // Writer thread
+    void write( void )
+    {
+      while( true )
+      {
+        Chunk *c;
+        {
+          std::unique_lock<std::mutex> lock( mutex );
+          cond.wait( lock, [this]{ return( !fullList.empty() || !isOpen ); } );
+          if( fullList.empty() )
+          {
+            return; // closed and everything written
+          }
+          c = fullList.front();
+          fullList.pop_front();
+        }
+
+        if( fwrite( c->data, 1, c->size, file ) != c->size )
+        {
+          fprintf( stderr, "StreamReader: write error\n" );
+        }
+
+        BYTE entry[16];
+        setQWord( entry,     c->firstSample );
+        setQWord( entry + 8, offset );
+        fwrite( entry, 1, sizeof(entry), index );
+
+        offset += c->size;
+        chunks++;
+        {
+          std::lock_guard<std::mutex> lock( mutex );
+          freeList.push_back( c );
+        }
+      }
+    }
+
+    //---------------------------------------------------------------
+    static void *allocAligned( DWORD size )
+    {
+      #ifdef _WIN32
+        return( _aligned_malloc( size, ALIGN ) );
+      #else
+        void *ptr = 0;
+        return( posix_memalign( &ptr, ALIGN, size ) == 0 ? ptr : 0 );
+      #endif
+    }
+
+    //---------------------------------------------------------------
+    static void freeAligned( void *ptr )
+    {
+      #ifdef _WIN32
+        _aligned_free( ptr );
+      #else
+        free( ptr );
+      #endif
+    }
+
+  private:
+    //---------------------------------------------------------------
+    FILE                   *file;
+    FILE                   *index;
+    QWORD                   offset;
+    Chunk                   chunk[NUM_OF_BUFFERS];
+    Chunk                  *current;   // filled by the reader
+    std::deque<Chunk *>     freeList;
+    std::deque<Chunk *>     fullList;
+    std::mutex              mutex;
+    std::condition_variable cond;
+    std::thread             writer;
+    bool                    isOpen;
+    volatile DWORD          overruns;
+    volatile DWORD          chunks;
+};
+
+//*******************************************************************
+class StreamReader
+{
+  public:
+    //---------------------------------------------------------------
+    StreamReader( CaptureFile *fileIn )
+    {
+      file       = fileIn;
+      isFirst    = true;
+      expected   = 0;
+      frames     = 0;
+      bytes      = 0;
+      rawBytes   = 0;
+      samples    = 0;
+      lost       = 0;
+      corrupt    = 0;
+      dropped    = 0;
+      sampleRate = 0;
+      last       = time( 0 );
+      decoded    = new BYTE[ 4 * 0xFFFF ];
+    }
+
+    //---------------------------------------------------------------
+    ~StreamReader( void )
+    {
+      delete[] decoded;
+    }
+
+    //---------------------------------------------------------------
+    // Check one received transfer, a transfer holds one frame
+    void process( const BYTE *data, DWORD size )
+    {
+      if( size == 0 )
+      {
+        return; // zero length packet: no block ready on the device
+      }
+
+      if(    size < HEADER_SIZE
+          || getWord( data ) != SYNC
+          || data[2] != VERSION
+          || getWord( data + 22 ) != checksum( data ) )
+      {
+        corrupt++;
+        return;
+      }
+
+      BYTE  mask         = data[3];
+      DWORD sequence     = getDWord( data +  4 );
+      WORD  numOfSamples = getWord ( data + 16 );
+      BYTE  coding       = data[18];
+      WORD  dataSize     = getWord ( data + 20 );
+      DWORD channels     = ( mask & 1 ) + ( ( mask >> 1 ) & 1 );
+      DWORD sampleSize   = 2 * numOfSamples * channels;
+
+      if( size != HEADER_SIZE + dataSize )
+      {
+        corrupt++;
+        return;
+      }
+
+      const BYTE *sample = data + HEADER_SIZE;
+
+      if( coding == CODING_RICE )
+      {
+        // channel after channel, into the interleaved layout of RAW
+        const BYTE *p   = sample;
+        const BYTE *end = sample + dataSize;
+
+        for( DWORD ch = 0; ch < channels && p; ch++ )
+        {
+          p = decodeRice( p, end, decoded + 2 * ch, numOfSamples, channels );
+        }
+        if( p != end )
+        {
+          corrupt++;
+          return;
+        }
+        sample = decoded;
+      }
+      else if( coding != CODING_RAW || dataSize != sampleSize )
+      {
+        corrupt++;
+        return;
+      }
+
+      // a gap of the sequence number is a block dropped by the device
+      // (see header) or lost on the way
+      if( !isFirst && sequence != expected )
+      {
+        lost += sequence - expected;
+      }
+      isFirst    = false;
+      expected   = sequence + 1;
+      sampleRate = getDWord( data +  8 );
+      dropped    = getDWord( data + 12 );
+
+      if( file )
+      {
+        // all blocks have the same size, so the sequence number gives
+        // the position of the samples, even after a gap
+        file->add( sample, sampleSize,
+                   (QWORD)sequence * numOfSamples, numOfSamples,
+                   mask, sampleRate );
+      }
+
+      frames++;
+      bytes    += size;
+      rawBytes += HEADER_SIZE + sampleSize;
+      samples  += numOfSamples;
+    }
+
+    //---------------------------------------------------------------
+    void printStatistics( void )
+    {
+      if( time( 0 ) == last )
+      {
+        return;
+      }
+      printf( "frames/s:%5u  kByte/s:%7.1f  ratio:%5.2f  samples/s:%7u (%u Hz)  lost:%u  dropped:%u  corrupt:%u",
+              frames, bytes/1024.0, bytes ? (double)rawBytes / bytes : 0.0,
+              samples, sampleRate, lost, dropped, corrupt );
+      if( file )
+      {
+        printf( "  chunks:%u  overrun:%u", file->getChunks(), file->getOverruns() );
+      }
+      printf( "\n" );
+      fflush( stdout );
+      frames = bytes = rawBytes = samples = 0;
+      last   = time( 0 );
+    }
+
+  private:
+    //---------------------------------------------------------------
+    CaptureFile *file;
+    bool         isFirst;
+    DWORD        expected;
+    DWORD        frames;
+    DWORD        bytes;
+    DWORD        rawBytes;   // size of the frames without coding
+    DWORD        samples;
+    DWORD        lost;
+    DWORD        corrupt;
+    DWORD        dropped;
+    DWORD        sampleRate;
+    time_t       last;
+    BYTE        *decoded;    // samples of a RICE frame
+};
+
+//*******************************************************************
+// Generates the frames like Src/Scope/Stream.cpp does
+class Loopback
+{
+  public:
+    //---------------------------------------------------------------
+    Loopback( DWORD sampleRateIn, BYTE codingIn )
+    {
+      sampleRate = sampleRateIn;
+      coding     = codingIn;
+      sequence   = 0;
+      dropped    = 0;
+      phase      = 0;
+    }
+
+    //---------------------------------------------------------------
+    // Get the number of frames due since the start
+    QWORD getDue( double seconds ) const
+    {
+      return( (QWORD)( seconds * sampleRate / BLOCK_SIZE ) );
+    }
+
+    //---------------------------------------------------------------
+    DWORD getSequence( void ) const
+    {
+      return( sequence );
+    }
+
+    //---------------------------------------------------------------
+    // Create the next frame (both channels)
+    DWORD makeFrame( BYTE *frame )
+    {
+      if( sequence % 1000 == 999 )
+      {
+        nextSamples( 0 ); // as dropped by the device
+        sequence++;
+        dropped++;
+      }
+
+      WORD  sample[2 * BLOCK_SIZE];
+      BYTE *h    = frame;
+      BYTE *data = frame + HEADER_SIZE;
+      DWORD size = 0;
+
+      nextSamples( sample );
+
+      if( coding == CODING_RICE )
+      {
+        // channel A, then channel B, as coded by the device
+        size  = encodeRice( sample,     BLOCK_SIZE, 2, data );
+        size += encodeRice( sample + 1, BLOCK_SIZE, 2, data + size );
+      }
+      else
+      {
+        for( DWORD i = 0; i < 2 * BLOCK_SIZE; i++ )
+        {
+          setWord( data + 2 * i, sample[i] );
+        }
+        size = 4 * BLOCK_SIZE;
+      }
+
+      setWord ( h +  0, SYNC );
+      h[2] = VERSION;
+      h[3] = 3;
+      setDWord( h +  4, sequence++ );
+      setDWord( h +  8, sampleRate ? sampleRate : 10000 );
+      setDWord( h + 12, dropped );
+      setWord ( h + 16, BLOCK_SIZE );
+      h[18] = coding;
+      h[19] = 0;
+      setWord ( h + 20, size );
+      setWord ( h + 22, checksum( h ) );
+
+      return( HEADER_SIZE + size );
+    }
+
+  private:
+    //---------------------------------------------------------------
+    // 16 bit codes like the device: sine on A, square wave on B,
+    // interleaved A, B, A, B, ...
+    void nextSamples( WORD *sample )
+    {
+      for( WORD i = 0; i < BLOCK_SIZE; i++, phase++ )
+      {
+        if( sample )
+        {
+          sample[2*i]     = (WORD)( 0x8000 + 0x7000 * sin( phase * 2 * M_PI / 100 ) );
+          sample[2*i + 1] = ( phase / 50 ) & 1 ? 0xE000 : 0x2000;
+        }
+      }
+    }
+
+  private:
+    //---------------------------------------------------------------
+    DWORD sampleRate;
+    BYTE  coding;
+    DWORD sequence;
+    DWORD dropped;
+    DWORD phase;
+};
+
+//*******************************************************************
+static int pending = 0; // transfers in flight
+
+//-------------------------------------------------------------------
+static void LIBUSB_CALL onTransfer( struct libusb_transfer *transfer )
+{
+  StreamReader *reader = (StreamReader *)transfer->user_data;
+
+  if( transfer->status == LIBUSB_TRANSFER_COMPLETED )
+  {
+    reader->process( transfer->buffer, transfer->actual_length );
+  }
+  else if( transfer->status != LIBUSB_TRANSFER_TIMED_OUT )
+  {
+    isRunning = false; // cancelled, device gone, ...
+  }
+
+  // resubmit at once, so the next transfer is queued while this
+  // one is processed
+  if( !isRunning || libusb_submit_transfer( transfer ) != 0 )
+  {
+    pending--;
+  }
+}
+
+//-------------------------------------------------------------------
+static void onSignal( int )
+{
+  isRunning = false;
+}
+
+//-------------------------------------------------------------------
+static void runLoopback( StreamReader &reader, DWORD sampleRate, BYTE coding, DWORD seconds )
+{
+  typedef std::chrono::steady_clock Clock;
+
+  Loopback    device( sampleRate, coding );
+  BYTE        frame[TRANSFER_SIZE];
+  Clock::time_point start = Clock::now();
+
+  printf( "StreamReader: loopback, %u Hz\n", sampleRate );
+
+  while( isRunning )
+  {
+    double t = std::chrono::duration<double>( Clock::now() - start ).count();
+
+    if( seconds && t >= seconds )
+    {
+      break;
+    }
+
+    if( sampleRate == 0 )
+    {
+      for( int i = 0; i < 1000; i++ )
+      {
+        reader.process( frame, device.makeFrame( frame ) );
+      }
+    }
+    else
+    {
+      while( device.getSequence() < device.getDue( t ) )
+      {
+        reader.process( frame, device.makeFrame( frame ) );
+      }
+      std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+    reader.printStatistics();
+  }
+}
+
+//-------------------------------------------------------------------
+static int runDevice( StreamReader &reader, int numOfTransfers, DWORD seconds )
+{
+  libusb_context       *ctx    = 0;
+  libusb_device_handle *handle = 0;
+
+  if( libusb_init( &ctx ) != 0 )
+  {
+    fprintf( stderr, "StreamReader: libusb not available\n" );
+    return( 1 );
+  }
+  handle = libusb_open_device_with_vid_pid( ctx, VID, PID );
+  if( !handle || libusb_claim_interface( handle, 0 ) != 0 )
+  {
+    fprintf( stderr, "StreamReader: device %04x:%04x not found\n", VID, PID );
+    return( 1 );
+  }
+
+  int  transferred;
+  BYTE cmd = CMD_START;
+
+  libusb_bulk_transfer( handle, EP_OUT, &cmd, 1, &transferred, 1000 );
+  printf( "StreamReader: started, %d transfers in flight\n", numOfTransfers );
+
+  struct libusb_transfer *transfer[MAX_TRANSFERS];
+
+  for( int i = 0; i < numOfTransfers; i++ )
+  {
+    transfer[i] = libusb_alloc_transfer( 0 );
+    libusb_fill_bulk_transfer( transfer[i], handle, EP_IN,
+                               new BYTE[TRANSFER_SIZE], TRANSFER_SIZE,
+                               onTransfer, &reader, 1000 );
+    if( libusb_submit_transfer( transfer[i] ) == 0 )
+    {
+      pending++;
+    }
+  }
+
+  time_t start = time( 0 );
+
+  while( isRunning && pending > 0 )
+  {
+    struct timeval tv = { 0, 100000 };
+    libusb_handle_events_timeout( ctx, &tv );
+    reader.printStatistics();
+
+    if( seconds && (DWORD)( time( 0 ) - start ) >= seconds )
+    {
+      isRunning = false;
+    }
+  }
+
+  // cancel and wait for the transfers in flight
+  isRunning = false;
+  for( int i = 0; i < numOfTransfers; i++ )
+  {
+    libusb_cancel_transfer( transfer[i] );
+  }
+  while( pending > 0 )
+  {
+    libusb_handle_events( ctx );
+  }
+
+  cmd = CMD_STOP;
+  libusb_bulk_transfer( handle, EP_OUT, &cmd, 1, &transferred, 1000 );
+
+  for( int i = 0; i < numOfTransfers; i++ )
+  {
+    delete[] transfer[i]->buffer;
+    libusb_free_transfer( transfer[i] );
+  }
+  libusb_release_interface( handle, 0 );
+  libusb_close( handle );
+  libusb_exit( ctx );
+  return( 0 );
+}
+
+//*******************************************************************
+int main( int argc, char *argv[] )
+{
+  int         numOfTransfers = 8;
+  DWORD       seconds        = 0;
+  const char *fileName       = 0;
+  bool        isLoopback     = false;
+  DWORD       loopbackRate   = 0;
+  BYTE        loopbackCoding = CODING_RICE;
+
+  for( int i = 1; i + 1 < argc; i += 2 )
+  {
+    if     ( !strcmp( argv[i], "-n" ) ) numOfTransfers = atoi( argv[i+1] );
+    else if( !strcmp( argv[i], "-t" ) ) seconds        = atoi( argv[i+1] );
+    else if( !strcmp( argv[i], "-o" ) ) fileName       = argv[i+1];
+    else if( !strcmp( argv[i], "-l" ) ) { isLoopback   = true;
+                                          loopbackRate = atoi( argv[i+1] ); }
+    else if( !strcmp( argv[i], "-c" ) ) loopbackCoding = atoi( argv[i+1] ) ? CODING_RICE : CODING_RAW;
+  }
+  if( numOfTransfers < 1             ) numOfTransfers = 1;
+  if( numOfTransfers > MAX_TRANSFERS ) numOfTransfers = MAX_TRANSFERS;
+
+  CaptureFile capture;
+
+  if( fileName && !capture.open( fileName ) )
+  {
+    fprintf( stderr, "StreamReader: can't create %s\n", fileName );
+    return( 1 );
+  }
+
+  signal( SIGINT, onSignal );
+
+  StreamReader reader( fileName ? &capture : 0 );
+  int          ret = 0;
+
+  if( isLoopback )
+  {
+    runLoopback( reader, loopbackRate, loopbackCoding, seconds );
+  }
+  else
+  {
+    ret = runDevice( reader, numOfTransfers, seconds );
+  }
+
+  capture.close();
+  reader.printStatistics();
+
+  printf( "StreamReader: stopped\n" );
+  return( ret );
+}
+
+//EOF
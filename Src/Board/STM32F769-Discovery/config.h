@@ -138,6 +138,16 @@ Adc_Mcu  adc( Adc_Mcu::ADC_3, timer );
 WORD     adc_A1 = 12;
 WORD     adc_A2 = 8;
 
+//-------------------------------------------------------------------
+// Memory
+//-------------------------------------------------------------------
+Memory_BKRAM  mem; // reference waveforms and mask
+
+// backup RAM is never erased, so the mask is stored behind the references.
+// Reference and Mask erase a flash memory as a whole, with Memory_Flash
+// (see configHw.h) the mask needs a Memory object of its own.
+Memory       &maskMem = mem;
+
 //-------------------------------------------------------------------
 // I2C
 //-------------------------------------------------------------------
@@ -146,14 +156,51 @@ I2Cmaster_Mcu i2cBusTouch( I2Cmaster_Mcu::I2C_4, 400/*kHz*/ );
 //-------------------------------------------------------------------
 // UART
 //-------------------------------------------------------------------
-Uart_Mcu   uart ( Uart_Mcu::USART_1, 9600, Uart_Mcu::NONE, 100, 100 );
+#define UART_BAUD_RATE  115200  // ST-LINK virtual COM port
+
+// small fifos, the output is buffered by UartTx (main.cpp)
+Uart_Mcu   uart ( Uart_Mcu::USART_1, UART_BAUD_RATE, Uart_Mcu::NONE, 100, 100 );
 
 Terminal   terminal( uart, 255,255,"# +" );
 
+//-------------------------------------------------------------------
+// USB
+//-------------------------------------------------------------------
+/// Select the USB interface of the sample stream:
+#define USE_USB_STREAM  'B'     // use 'C': virtual COM port (CDC), 'B': vendor bulk (WinUSB)
+
+#ifdef USB_DEVICE_ENABLE
+  #if USE_USB_STREAM == 'C'
+    #include "../../Main/Module/USB/ModUSB_Uart/descriptor.cpp"
+  #elif USE_USB_STREAM == 'B'
+    #include "../../Scope/BulkLink/descriptor.cpp"
+  #else
+    #error "Compiler flag 'USE_USB_STREAM' not defined or wrong value"
+  #endif
+
+  USBdeviceDescriptor_0   desc;
+  USBdevice_Mcu           usb( desc );
+
+  #if USE_USB_STREAM == 'C'
+    // virtual COM port, sample stream to the host
+    USB_Uart              usbUart( usb, 1,      // configId
+                                        0,      // interfId
+                                        4096 ); // fifo size
+  #endif
+#endif
+
 //-------------------------------------------------------------------
 // Display
 //-------------------------------------------------------------------
-#include "../../Resource/Font/Font_10x20.h"
+#define DISPLAY_WIDTH   800
+#define DISPLAY_HEIGHT  480
+
+#include "../../Resource/Font/Packed/Font_10x20.h"
+#include "../../Scope/PackedResource.h"
+#include "../../Scope/Screenshot.h"
+
+// packed in flash, unpacked once into RAM
+Font          fontFont_10x20( PackedResource::load( fontFont_10x20_packed ) );
 
 Port::Pin     lcdResetPin( portJ, 15 );
 Fmc_Mcu       fmc        ( Fmc_Mcu::SDRAM_Bank1 );  
@@ -166,10 +213,15 @@ DisplayGraphic_OTM8009Aram dispGraphic( hwDSI,lcdResetPin,
 
 ScreenGraphic screen( dispGraphic );
 
+// PNG of the framebuffer in SDRAM, the panel is portrait (480x800),
+// its rows are the columns of the landscape screen
+Screenshot    screenshot( (const WORD *)fmc.startAddr(), DISPLAY_WIDTH, DISPLAY_HEIGHT,
+                          Screenshot::ROTATED_90 );
+
 //-------------------------------------------------------------------
 // Touch
 //-------------------------------------------------------------------
-Touch_FT6206 touch( i2cBusTouch, 800, 480 );
+Touch_FT6206 touch( i2cBusTouch, DISPLAY_WIDTH, DISPLAY_HEIGHT );
 
 Pointer        pointer( touch );
 
@@ -0,0 +1,215 @@
+//*******************************************************************
+/*!
+\file   Adc_Replay.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Virtual ADC, which replays a recorded capture file
+*/
+
+//*******************************************************************
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+#include <stdio.h>
+
+#include "Adc_Replay.h"
+
+//*******************************************************************
+//
+// Adc_Replay
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Adc_Replay::Adc_Replay( const char *fileName )
+{
+  data         = 0;
+  dataSize     = 0;
+  isMapped     = false;
+  chunk        = 0;
+  chunkSize    = 0;
+  numOfSamples = 0;
+  channelMask  = 0;
+  pos          = 0;
+  sample[0]    = 0;
+  sample[1]    = 0;
+  isRead       = 0;
+  frames       = 0;
+
+#ifndef _WIN32
+  int fd = open( fileName, O_RDONLY );
+  if( fd >= 0 )
+  {
+    struct stat st;
+    if( fstat( fd, &st ) == 0 && st.st_size > 0 )
+    {
+      void *p = mmap( 0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+      if( p != MAP_FAILED )
+      {
+        data     = (BYTE *)p;
+        dataSize = st.st_size;
+        isMapped = true;
+      }
+    }
+    ::close( fd ); // the mapping stays valid
+  }
+#else
+  FILE *f = fopen( fileName, "rb" );
+  if( f )
+  {
+    fseek( f, 0, SEEK_END );
+    long size = ftell( f );
+    fseek( f, 0, SEEK_SET );
+    if( size > 0 )
+    {
+      data = new BYTE[ size ];
+      if( fread( data, 1, size, f ) == (size_t)size )
+      {
+        dataSize = size;
+      }
+      else
+      {
+        delete[] data;
+        data = 0;
+      }
+    }
+    fclose( f );
+  }
+#endif
+
+  // start at the first chunk, the position is incremented by nextChunk()
+  chunkSize = 0;
+  if( !data || !nextChunk() )
+  {
+    fprintf( stderr, "Adc_Replay: no samples in %s\n", fileName );
+    close();
+    return;
+  }
+  load();
+}
+
+//-------------------------------------------------------------------
+Adc_Replay::~Adc_Replay( void )
+{
+  close();
+}
+
+//-------------------------------------------------------------------
+void Adc_Replay::close( void )
+{
+  if( data )
+  {
+#ifndef _WIN32
+    if( isMapped )
+    {
+      munmap( data, dataSize );
+    }
+#else
+    delete[] data;
+#endif
+    data = 0;
+  }
+}
+
+//-------------------------------------------------------------------
+WORD Adc_Replay::get( BYTE ch )
+{
+  if( !data || ch > 1 )
+  {
+    return( 0 );
+  }
+
+  // a channel read again belongs to the next acquisition
+  if( isRead & ( 1 << ch ) )
+  {
+    if( ++pos >= numOfSamples )
+    {
+      nextChunk();
+    }
+    load();
+    isRead = 0;
+    frames++;
+  }
+  isRead |= 1 << ch;
+
+  return( sample[ch] );
+}
+
+//-------------------------------------------------------------------
+bool Adc_Replay::nextChunk( void )
+{
+  DWORD next = chunk + chunkSize;
+
+  // at most one pass over the file, an empty one gives up
+  for( DWORD i = 0; i <= dataSize / CHUNK_HEADER; i++ )
+  {
+    if( next + CHUNK_HEADER > dataSize || getDWord( next ) != MAGIC )
+    {
+      if( next == 0 )
+      {
+        return( false );
+      }
+      next = 0; // end of the file or corrupt, replay from the start
+      continue;
+    }
+
+    BYTE  mask     = data[next + 5];
+    DWORD n        = getDWord( next + 12 );
+    DWORD size     = getDWord( next + 28 );
+    DWORD channels = ( mask & 1 ) + ( ( mask >> 1 ) & 1 );
+
+    if(    data[next + 4] != VERSION
+        || channels == 0
+        || size < CHUNK_HEADER
+        || size > dataSize - next
+        || n > ( size - CHUNK_HEADER ) / ( 2 * channels )
+        || getDWord( next + 24 ) != 2 * n * channels )
+    {
+      if( next == 0 )
+      {
+        return( false );
+      }
+      next = 0;
+      continue;
+    }
+
+    if( n > 0 )
+    {
+      chunk        = next;
+      chunkSize    = size;
+      numOfSamples = n;
+      channelMask  = mask;
+      pos          = 0;
+      return( true );
+    }
+    next += size;
+  }
+  return( false );
+}
+
+//-------------------------------------------------------------------
+void Adc_Replay::load( void )
+{
+  DWORD       channels = ( channelMask & 1 ) + ( ( channelMask >> 1 ) & 1 );
+  const BYTE *p        = data + chunk + CHUNK_HEADER + 2 * pos * channels;
+
+  // interleaved A, B, ... as in the frames of the stream
+  sample[0] = ( channelMask & 1 ) ? p[0] | ( p[1] << 8 ) : 0;
+  if( channelMask & 1 )
+  {
+    p += 2;
+  }
+  sample[1] = ( channelMask & 2 ) ? p[0] | ( p[1] << 8 ) : 0;
+}
+
+//-------------------------------------------------------------------
+DWORD Adc_Replay::getDWord( DWORD offset ) const
+{
+  const BYTE *p = data + offset;
+
+  return( p[0] | ( p[1] << 8 ) | ( p[2] << 16 ) | ( (DWORD)p[3] << 24 ) );
+}
+
+//EOF
@@ -0,0 +1,125 @@
+//*******************************************************************
+/*!
+\file   Adc_Replay.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Virtual ADC, which replays a recorded capture file
+*/
+
+//*******************************************************************
+#ifndef _ADC_REPLAY_H
+#define _ADC_REPLAY_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+
+//*******************************************************************
+/*!
+\class Adc_Replay
+
+\brief Takes the samples of a capture file instead of the slider of
+       the VirtualDeviceServer
+
+Offers enable() and get() like Adc_Virtual, so it replaces it in
+config.h without a change of the application. Channel 0 is channel A
+of the file, channel 1 is channel B (0, if the file has no B).
+
+A frame (the samples of both channels at one time) is taken per
+acquisition: get() of a channel, which was already read, advances to
+the next frame. So the n-th acquisition always gets the n-th sample,
+independent of whether it is called by the timer (real time) or by a
+loop as fast as possible. The trigger, measurements and rendering run
+on identical input in each run.
+
+The chunks of the file are replayed one after another, the samples
+lost between two chunks are skipped. At the end of the file (or at the
+first corrupt chunk) the replay starts again at the beginning.
+
+The file is mapped into memory on Linux, on Windows it is read once.
+
+\see Project/Virtual/StreamReader/StreamReader.cpp (file format)
+*/
+class Adc_Replay
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Open a capture file
+        \param fileName Capture file of StreamReader
+    */
+    Adc_Replay( const char *fileName );
+
+    //---------------------------------------------------------------
+    ~Adc_Replay( void );
+
+    //---------------------------------------------------------------
+    /*! Nothing to configure, for the interface of Adc_Virtual
+    */
+    void enable( BYTE ch )
+    {
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the sample of a channel
+        \param ch Channel, 0: A, 1: B
+        \return Code of the sample, 0 if the file is not valid
+    */
+    WORD get( BYTE ch );
+
+    //---------------------------------------------------------------
+    /*! The file has been opened and holds samples
+    */
+    bool isValid( void ) const
+    {
+      return( data != 0 );
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the number of frames taken since the start
+    */
+    DWORD getFrames( void ) const
+    {
+      return( frames );
+    }
+
+  private:
+    //---------------------------------------------------------------
+    enum
+    {
+      MAGIC        = 0x4B484353, // 'SCHK'
+      VERSION      = 1,
+      CHUNK_HEADER = 32
+    };
+
+    //---------------------------------------------------------------
+    void close( void );
+
+    //---------------------------------------------------------------
+    // Go to the next chunk with samples, at the end to the first one
+    bool nextChunk( void );
+
+    //---------------------------------------------------------------
+    // Take the samples at pos of the chunk
+    void load( void );
+
+    //---------------------------------------------------------------
+    DWORD getDWord( DWORD offset ) const;
+
+  private:
+    //---------------------------------------------------------------
+    BYTE  *data;
+    DWORD  dataSize;
+    bool   isMapped;
+
+    DWORD  chunk;        // offset of the current chunk
+    DWORD  chunkSize;    // header, samples and padding
+    DWORD  numOfSamples; // per channel
+    BYTE   channelMask;
+    DWORD  pos;          // sample in the chunk
+
+    WORD   sample[2];    // current frame
+    BYTE   isRead;       // channels of the current frame already read
+    DWORD  frames;
+
+}; //Adc_Replay
+
+#endif
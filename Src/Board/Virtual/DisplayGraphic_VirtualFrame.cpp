@@ -0,0 +1,379 @@
+//*******************************************************************
+/*!
+\file   DisplayGraphic_VirtualFrame.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Virtual graphic display with local framebuffer and batched transfer
+*/
+
+//*******************************************************************
+#ifdef _WIN32
+  #include <winsock2.h>
+#else
+  #include <sys/socket.h>
+  #include <netinet/in.h>
+  #include <netinet/tcp.h>
+  #include <netdb.h>
+  #include <unistd.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+
+#include "DisplayGraphic_VirtualFrame.h"
+
+//*******************************************************************
+//
+// DisplayGraphic_VirtualFrame
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+DisplayGraphic_VirtualFrame::DisplayGraphic_VirtualFrame( WORD        width,
+                                                          WORD        height,
+                                                          const char *server,
+                                                          const char *frameServer,
+                                                          Font        font,
+                                                          BYTE        zoom,
+                                                          bool        compressIn )
+
+: DisplayGraphic_Virtual( width, height, server, font, zoom )
+
+{
+  frameWidth  = width;
+  frameHeight = height;
+
+  frame    = new WORD[ (DWORD)width * height ];
+  dirtyMin = new WORD[ height ];
+  dirtyMax = new WORD[ height ];
+
+  memset( frame, 0, (DWORD)width * height * sizeof(WORD) );
+
+  // mark everything as dirty, so the first refresh sends the whole frame
+  for( WORD y = 0; y < height; y++ )
+  {
+    dirtyMin[y] = 0;
+    dirtyMax[y] = width - 1;
+  }
+
+  areaX = areaY = 0;
+  areaW = width;
+  areaH = height;
+  posX  = posY  = 0;
+
+  // worst case: every row dirty, raw coded plus some RLE tokens
+  bufSize = 20 + (DWORD)height * (6 + 2*(DWORD)width + 16);
+  buf     = new BYTE[ bufSize ];
+  bufPos  = 0;
+
+  compress = compressIn;
+  frameNo  = 0;
+  sock     = -1;
+
+  if( frameServer )
+  {
+    connect( frameServer );
+  }
+}
+
+//-------------------------------------------------------------------
+void DisplayGraphic_VirtualFrame::refresh( void )
+{
+  if( isBatched() )
+  {
+    sendBatch();
+  }
+  else
+  {
+    sendSpans();
+  }
+
+  for( WORD y = 0; y < frameHeight; y++ )
+  {
+    dirtyMin[y] = 0xFFFF;
+    dirtyMax[y] = 0;
+  }
+  frameNo++;
+
+  DisplayGraphic_Virtual::refresh();
+}
+
+//-------------------------------------------------------------------
+void DisplayGraphic_VirtualFrame::setArea( WORD x, WORD y, WORD w, WORD h )
+{
+  areaX = x;
+  areaY = y;
+  areaW = w;
+  areaH = h;
+  posX  = x;
+  posY  = y;
+}
+
+//-------------------------------------------------------------------
+void DisplayGraphic_VirtualFrame::setPixel( WORD color )
+{
+  setPixel( color, posX, posY );
+
+  if( ++posX >= areaX + areaW )
+  {
+    posX = areaX;
+    if( ++posY >= areaY + areaH )
+    {
+      posY = areaY;
+    }
+  }
+}
+
+//-------------------------------------------------------------------
+void DisplayGraphic_VirtualFrame::setPixel( WORD color, WORD x, WORD y )
+{
+  if( x >= frameWidth || y >= frameHeight )
+  {
+    return;
+  }
+
+  WORD &pixel = frame[ (DWORD)y * frameWidth + x ];
+
+  if( pixel != color )
+  {
+    pixel = color;
+    markDirty( x, y );
+  }
+}
+
+//-------------------------------------------------------------------
+void DisplayGraphic_VirtualFrame::markDirty( WORD x, WORD y )
+{
+  if( x < dirtyMin[y] ) dirtyMin[y] = x;
+  if( x > dirtyMax[y] ) dirtyMax[y] = x;
+}
+
+//-------------------------------------------------------------------
+void DisplayGraphic_VirtualFrame::sendBatch( void )
+{
+  WORD numOfSpans = 0;
+
+  bufPos = 20; // header is written at the end
+
+  for( WORD y = 0; y < frameHeight; y++ )
+  {
+    if( dirtyMin[y] > dirtyMax[y] )
+    {
+      continue;
+    }
+
+    WORD        x     = dirtyMin[y];
+    WORD        w     = dirtyMax[y] - x + 1;
+    const WORD *pixel = &frame[ (DWORD)y * frameWidth + x ];
+    DWORD       start = bufPos;
+
+    put( y );
+    put( x );
+    put( w );
+
+    // use RLE coding only, if it is shorter
+    if( compress && encode( pixel, w ) < w )
+    {
+      buf[start + 5] |= RLE >> 8;
+    }
+    else
+    {
+      bufPos = start + 6;
+      for( WORD i = 0; i < w; i++ )
+      {
+        put( pixel[i] );
+      }
+    }
+    numOfSpans++;
+  }
+
+  if( numOfSpans == 0 )
+  {
+    return;
+  }
+
+  DWORD size = bufPos;
+
+  bufPos = 0;
+  putDWord( MAGIC );
+  put     ( frameWidth );
+  put     ( frameHeight );
+  putDWord( frameNo );
+  put     ( numOfSpans );
+  put     ( 0 );
+  putDWord( size - 20 );
+
+  for( DWORD sent = 0; sent < size; )
+  {
+    int ret = send( sock, (const char *)&buf[sent], size - sent, 0 );
+    if( ret <= 0 )
+    {
+      // frame server gone, continue with the VirtualDeviceServer
+      #ifdef _WIN32
+        closesocket( sock );
+      #else
+        close( sock );
+      #endif
+      sock = -1;
+
+      for( WORD y = 0; y < frameHeight; y++ )
+      {
+        dirtyMin[y] = 0;
+        dirtyMax[y] = frameWidth - 1;
+      }
+      sendSpans();
+      return;
+    }
+    sent += ret;
+  }
+}
+
+//-------------------------------------------------------------------
+void DisplayGraphic_VirtualFrame::sendSpans( void )
+{
+  WORD y = 0;
+
+  while( y < frameHeight )
+  {
+    if( dirtyMin[y] > dirtyMax[y] )
+    {
+      y++;
+      continue;
+    }
+
+    // merge following rows with the same span into one area
+    WORD h = 1;
+    while(    y + h < frameHeight
+           && dirtyMin[y + h] == dirtyMin[y]
+           && dirtyMax[y + h] == dirtyMax[y] )
+    {
+      h++;
+    }
+
+    WORD x = dirtyMin[y];
+    WORD w = dirtyMax[y] - x + 1;
+
+    DisplayGraphic_Virtual::setArea( x, y, w, h );
+    for( WORD r = y; r < y + h; r++ )
+    {
+      const WORD *pixel = &frame[ (DWORD)r * frameWidth + x ];
+      for( WORD i = 0; i < w; i++ )
+      {
+        DisplayGraphic_Virtual::setPixel( pixel[i] );
+      }
+    }
+    y += h;
+  }
+}
+
+//-------------------------------------------------------------------
+WORD DisplayGraphic_VirtualFrame::encode( const WORD *pixel, WORD w )
+{
+  DWORD start = bufPos;
+  WORD  i     = 0;
+
+  while( i < w )
+  {
+    // run of equal colors
+    WORD run = 1;
+    while( i + run < w && pixel[i + run] == pixel[i] && run < 0x7FFF )
+    {
+      run++;
+    }
+    if( run >= 3 )
+    {
+      put( RLE | run );
+      put( pixel[i] );
+      i += run;
+      continue;
+    }
+
+    // literal colors up to the next run
+    WORD first = i;
+    while( i < w && i - first < 0x7FFF )
+    {
+      if(    i + 2 < w
+          && pixel[i] == pixel[i + 1]
+          && pixel[i] == pixel[i + 2] )
+      {
+        break;
+      }
+      i++;
+    }
+    put( i - first );
+    for( WORD k = first; k < i; k++ )
+    {
+      put( pixel[k] );
+    }
+  }
+  return( (bufPos - start) / 2 );
+}
+
+//-------------------------------------------------------------------
+void DisplayGraphic_VirtualFrame::put( WORD data )
+{
+  buf[bufPos++] = data & 0xFF;
+  buf[bufPos++] = data >> 8;
+}
+
+//-------------------------------------------------------------------
+void DisplayGraphic_VirtualFrame::putDWord( DWORD data )
+{
+  put( data & 0xFFFF );
+  put( data >> 16 );
+}
+
+//-------------------------------------------------------------------
+bool DisplayGraphic_VirtualFrame::connect( const char *address )
+{
+  char host[64];
+  int  port = 0;
+
+  const char *colon = strchr( address, ':' );
+  if( !colon || colon - address >= (int)sizeof(host) )
+  {
+    return( false );
+  }
+  memcpy( host, address, colon - address );
+  host[colon - address] = 0;
+  port = atoi( colon + 1 );
+
+  #ifdef _WIN32
+    WSADATA wsaData;
+    WSAStartup( MAKEWORD( 2, 2 ), &wsaData );
+  #endif
+
+  struct hostent *he = gethostbyname( host );
+  if( !he )
+  {
+    return( false );
+  }
+
+  struct sockaddr_in addr;
+  memset( &addr, 0, sizeof(addr) );
+  addr.sin_family = AF_INET;
+  addr.sin_port   = htons( port );
+  memcpy( &addr.sin_addr, he->h_addr, he->h_length );
+
+  int s = socket( AF_INET, SOCK_STREAM, 0 );
+  if( s < 0 )
+  {
+    return( false );
+  }
+
+  if( ::connect( s, (struct sockaddr *)&addr, sizeof(addr) ) < 0 )
+  {
+    #ifdef _WIN32
+      closesocket( s );
+    #else
+      close( s );
+    #endif
+    return( false );
+  }
+
+  int flag = 1;
+  setsockopt( s, IPPROTO_TCP, TCP_NODELAY, (const char *)&flag, sizeof(flag) );
+
+  sock = s;
+  return( true );
+}
+
+//EOF
@@ -0,0 +1,152 @@
+//*******************************************************************
+/*!
+\file   DisplayGraphic_VirtualFrame.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Virtual graphic display with local framebuffer and batched transfer
+*/
+
+//*******************************************************************
+#ifndef _DISPLAY_GRAPHIC_VIRTUAL_FRAME_H
+#define _DISPLAY_GRAPHIC_VIRTUAL_FRAME_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+
+using namespace EmbSysLib::Hw;
+
+//*******************************************************************
+/*!
+\class DisplayGraphic_VirtualFrame
+
+\brief Virtual display, which renders into a local RGB565 framebuffer
+
+All drawing goes into a local framebuffer. Changed pixels are tracked as
+one dirty span per row. On refresh() the dirty spans are sent:
+- as one batched message to a frame server, if connected (see below)
+- otherwise through DisplayGraphic_Virtual to the VirtualDeviceServer,
+  but only once per refresh and only the changed spans
+
+Batch message (little endian):
+\code
+  Header: DWORD magic ('FRM1'), WORD width, WORD height,
+          DWORD frameNo, WORD numOfSpans, WORD reserved,
+          DWORD payloadSize
+  Span:   WORD y, WORD x, WORD w (bit 15: RLE coded), data
+  Data:   raw   : w colors
+          RLE   : tokens, bit 15 set: run of (token & 0x7FFF) times
+                  the following color, else: token literal colors follow
+\endcode
+
+\see Project/Virtual/FrameServer/FrameServer.cpp
+*/
+class DisplayGraphic_VirtualFrame : public DisplayGraphic_Virtual
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      MAGIC = 0x314D5246, // 'FRM1'
+      RLE   = 0x8000
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate the display
+        \param width       Display width [px]
+        \param height      Display height [px]
+        \param server      Address of the VirtualDeviceServer
+        \param frameServer Address of the frame server or 0
+        \param font        Font
+        \param zoom        Zoom factor
+        \param compress    RLE coding of the batched spans
+    */
+    DisplayGraphic_VirtualFrame( WORD        width,
+                                 WORD        height,
+                                 const char *server,
+                                 const char *frameServer,
+                                 Font        font,
+                                 BYTE        zoom,
+                                 bool        compress = true );
+
+    //---------------------------------------------------------------
+    /*! Send all changed spans and refresh the display
+    */
+    virtual void refresh( void );
+
+    //---------------------------------------------------------------
+    /*! Check, if the frame server is connected
+    */
+    bool isBatched( void )
+    {
+      return( sock >= 0 );
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the local framebuffer, RGB565 row by row
+    */
+    const WORD *getFrame( void ) const
+    {
+      return( frame );
+    }
+
+  protected:
+    //---------------------------------------------------------------
+    virtual void setArea( WORD x, WORD y, WORD w, WORD h );
+
+    //---------------------------------------------------------------
+    virtual void setPixel( WORD color );
+
+    //---------------------------------------------------------------
+    virtual void setPixel( WORD color, WORD x, WORD y );
+
+  private:
+    //---------------------------------------------------------------
+    void markDirty( WORD x, WORD y );
+
+    //---------------------------------------------------------------
+    void sendBatch( void );
+
+    //---------------------------------------------------------------
+    void sendSpans( void );
+
+    //---------------------------------------------------------------
+    void put( WORD data );
+    void putDWord( DWORD data );
+
+    //---------------------------------------------------------------
+    WORD encode( const WORD *pixel, WORD w );
+
+    //---------------------------------------------------------------
+    bool connect( const char *address );
+
+  private:
+    //---------------------------------------------------------------
+    WORD   frameWidth;
+    WORD   frameHeight;
+    WORD  *frame;
+
+    // dirty span per row, dirtyMin > dirtyMax: row is clean
+    WORD  *dirtyMin;
+    WORD  *dirtyMax;
+
+    // actual drawing area and position
+    WORD   areaX;
+    WORD   areaY;
+    WORD   areaW;
+    WORD   areaH;
+    WORD   posX;
+    WORD   posY;
+
+    // batch buffer
+    BYTE  *buf;
+    DWORD  bufSize;
+    DWORD  bufPos;
+
+    bool   compress;
+    DWORD  frameNo;
+    int    sock;
+
+}; //DisplayGraphic_VirtualFrame
+
+#endif
@@ -13,6 +13,10 @@ Board:    Virtual
 \see Virtual/board_pinout.txt
 */
 
+//*******************************************************************
+#include "DisplayGraphic_VirtualFrame.cpp"
+#include "Adc_Replay.cpp"
+
 //*******************************************************************
 using namespace EmbSysLib::Hw;
 using namespace EmbSysLib::Dev;
@@ -34,28 +38,64 @@ TaskManager taskManager( timer );
 //-------------------------------------------------------------------
 // ADC
 //-------------------------------------------------------------------
-Adc_Virtual  adc( "localhost:1000", timer );
-WORD     adc_A1 = 0;
-WORD     adc_A2 = 0;
+#define USE_ADC  'V'  // use 'V': slider of the VirtualDeviceServer,
+                      //     'R': replay of a capture file in real time (one sample per timer tick),
+                      //     'F': replay as fast as possible (samples taken by the main loop)
+
+#if USE_ADC == 'V'
+  Adc_Virtual  adc( "localhost:1000", timer );
+  WORD     adc_A1 = 0;
+  WORD     adc_A2 = 0;
+#elif USE_ADC == 'R' || USE_ADC == 'F'
+  // recorded by Project/Virtual/StreamReader (-o), channel 0: A, 1: B
+  Adc_Replay   adc( "capture.bin" );
+  WORD     adc_A1 = 0;
+  WORD     adc_A2 = 1;
+#else
+  #error "Compiler flag 'USE_ADC' not defined or wrong value"
+#endif
+
+//-------------------------------------------------------------------
+// Memory
+//-------------------------------------------------------------------
+Memory_Mcu  mem    ( "mem.bin",  2048 ); // reference waveforms
+Memory_Mcu  maskMem( "mask.bin", 512  ); // mask test
 
 //-------------------------------------------------------------------
 // Display
 //-------------------------------------------------------------------
+#define DISPLAY_WIDTH   800
+#define DISPLAY_HEIGHT  480
+
 //*******************************************************************
 #include "../../Resource/Color/Color.h"
-
-Font        fontFont_10x20      ( Memory_Mcu( "../../../Src/Resource/Font/font_10x20.bin"       ).getPtr() );
-Font        fontFont_16x24      ( Memory_Mcu( "../../../Src/Resource/Font/font_16x24.bin"       ).getPtr() );
-Font        fontFont_8x12       ( Memory_Mcu( "../../../Src/Resource/Font/font_8x12.bin"        ).getPtr() );
-Font        fontFont_8x8        ( Memory_Mcu( "../../../Src/Resource/Font/font_8x8.bin"         ).getPtr() );
-
-DisplayGraphic_Virtual  dispGraphic( 800, 480, "localhost:1000", fontFont_8x12, 1 );
+#include "../../Scope/PackedResource.h"
+#include "../../Scope/Screenshot.h"
+
+// packed fonts, unpacked once at startup (unpacked files work as well)
+Font        fontFont_10x20      ( PackedResource::load( Memory_Mcu( "../../../Src/Resource/Font/Packed/Font_10x20.bin" ).getPtr() ) );
+Font        fontFont_16x24      ( PackedResource::load( Memory_Mcu( "../../../Src/Resource/Font/Packed/Font_16x24.bin" ).getPtr() ) );
+Font        fontFont_8x12       ( PackedResource::load( Memory_Mcu( "../../../Src/Resource/Font/Packed/Font_8x12.bin"  ).getPtr() ) );
+Font        fontFont_8x8        ( PackedResource::load( Memory_Mcu( "../../../Src/Resource/Font/Packed/Font_8x8.bin"   ).getPtr() ) );
+
+// renders into a local framebuffer, changed areas are sent once per refresh
+// in one batch to the FrameServer (if running) or to the VirtualDeviceServer
+DisplayGraphic_VirtualFrame  dispGraphic( DISPLAY_WIDTH, DISPLAY_HEIGHT,
+                                          "localhost:1000",  // VirtualDeviceServer
+                                          "localhost:1001",  // FrameServer (optional)
+                                          fontFont_8x12, 1 );
 
 ScreenGraphic screen( dispGraphic );
 
+// PNG of the local framebuffer
+Screenshot    screenshot( dispGraphic.getFrame(), DISPLAY_WIDTH, DISPLAY_HEIGHT,
+                          Screenshot::ROW_MAJOR );
+
 //-------------------------------------------------------------------
 // UART
 //-------------------------------------------------------------------
+#define UART_BAUD_RATE  115200  // paces the output of UartTx only
+
 Uart_Stdio uart( true );
 
 Terminal   terminal( uart, 255,255,"# +" );
@@ -63,7 +103,7 @@ Terminal   terminal( uart, 255,255,"# +" );
 //-------------------------------------------------------------------
 // Touch
 //-------------------------------------------------------------------
-Touch_Virtual  touch( "localhost:1000", 320, 240 );
+Touch_Virtual  touch( "localhost:1000", DISPLAY_WIDTH, DISPLAY_HEIGHT );
 
 Pointer        pointer( touch );
 
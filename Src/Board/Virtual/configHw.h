@@ -88,11 +88,16 @@ BYTE DacChannelList[] = {0,1,2,3};
 
 #elif USE_RESOURCE == 'I'
 
+  #include "../../Scope/PackedResource.h"
+
   Memory_Mcu  image   ( "../image.bin" );
-  Font        fontFont_10x20      ( MemoryImage( image, "Font_10x20"     ).getPtr() );
-  Font        fontFont_16x24      ( MemoryImage( image, "Font_16x24"     ).getPtr() );
-  Font        fontFont_8x12       ( MemoryImage( image, "Font_8x12"      ).getPtr() );
-  Font        fontFont_8x8        ( MemoryImage( image, "Font_8x8"       ).getPtr() );
+
+  // fonts packed (see Src/Resource/Pack), unpacked once into RAM,
+  // the bitmap is taken unpacked straight from the image
+  Font        fontFont_10x20      ( PackedResource::load( MemoryImage( image, "Font_10x20" ).getPtr() ) );
+  Font        fontFont_16x24      ( PackedResource::load( MemoryImage( image, "Font_16x24" ).getPtr() ) );
+  Font        fontFont_8x12       ( PackedResource::load( MemoryImage( image, "Font_8x12"  ).getPtr() ) );
+  Font        fontFont_8x8        ( PackedResource::load( MemoryImage( image, "Font_8x8"   ).getPtr() ) );
   Bitmap      bitmapBitmap_320x240( MemoryImage( image, "Bitmap_320x240" ).getPtr() );
 
 #elif USE_RESOURCE == 'F'
@@ -7,6 +7,10 @@
 
 //*******************************************************************
 
+//*******************************************************************
+#ifndef _RESOURCE_COLOR_H
+#define _RESOURCE_COLOR_H
+
 //*******************************************************************
 //#include "MCU_Types.h"
 
@@ -69,10 +73,22 @@ class Color
 
    } colorPredefined;
 
+    //---------------------------------------------------------------
+    /*! Color code of a RGB value (8 bit per component)
+        \param red,green,blue Components 0...255
+        eturn Color in the coding above
+    */
+    static constexpr WORD rgb( BYTE red, BYTE green, BYTE blue )
+    {
+      return( RGB2COLOR( red, green, blue ) );
+    }
+
 //-------------------------------------------------------------------
 #undef RGB2COLOR
 //-------------------------------------------------------------------
 
 }; //Color
 
+#endif
+
 
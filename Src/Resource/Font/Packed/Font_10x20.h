@@ -0,0 +1,123 @@
+
+
+// Source: Font_10x20.bin (packed, 2405 -> 1810 byte)
+
+
+ static const BYTE fontFont_10x20_packed[1810] PROGMEM
+ = {
+     0x52,0x4C,0x45,0x01,0x65,0x09,0x00,0x00,0x04,0x20,0x7F,0x19,0x0A,0x14,0x9A,0x00,
+     0x0C,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x81,0x00,
+     0x02,0x10,0x04,0x01,0x83,0x00,0x05,0x03,0x30,0xCC,0x11,0x04,0x40,0x92,0x00,0x12,
+     0x48,0x12,0x04,0x81,0x23,0xFC,0x24,0x09,0x02,0x41,0x20,0x48,0x12,0x1F,0xE2,0x40,
+     0x90,0x24,0x09,0x81,0x00,0x17,0x04,0x01,0x01,0xE8,0x96,0x44,0xD1,0x14,0x44,0x90,
+     0x1C,0x01,0xC0,0x48,0x11,0x44,0x51,0x16,0x44,0xD2,0x2F,0x01,0x00,0x40,0x81,0x00,
+     0x12,0x01,0x84,0x9E,0x44,0x91,0x44,0x90,0xC8,0x02,0x01,0x00,0x80,0x26,0x12,0x45,
+     0x12,0x44,0x92,0x43,0x84,0x00,0x13,0x01,0xC0,0x88,0x22,0x08,0x82,0x20,0x50,0x08,
+     0x05,0x72,0x49,0x0A,0x42,0x90,0x44,0x10,0x8A,0x1C,0x40,0x84,0x00,0x03,0xC0,0x30,
+     0x04,0x01,0x92,0x00,0x2D,0x10,0x08,0x04,0x01,0x00,0x80,0x20,0x08,0x02,0x00,0x80,
+     0x20,0x08,0x02,0x00,0x80,0x20,0x04,0x01,0x00,0x20,0x04,0x00,0x00,0x10,0x02,0x00,
+     0x40,0x10,0x02,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x40,
+     0x10,0x08,0x04,0x88,0x00,0x08,0x81,0x24,0x2A,0x07,0x01,0xC0,0xA8,0x49,0x02,0x8E,
+     0x00,0x0A,0x40,0x10,0x04,0x01,0x07,0xFC,0x10,0x04,0x01,0x00,0x40,0x97,0x00,0x04,
+     0x30,0x0C,0x01,0x00,0x80,0x8B,0x00,0x01,0x07,0xFC,0x9C,0x00,0x01,0x30,0x0C,0x85,
+     0x00,0x12,0x08,0x02,0x01,0x00,0x40,0x20,0x08,0x04,0x01,0x00,0x80,0x20,0x10,0x04,
+     0x02,0x00,0x80,0x40,0x10,0x84,0x00,0x11,0xE0,0x44,0x20,0x88,0x24,0x05,0x01,0x40,
+     0x50,0x14,0x05,0x01,0x40,0x48,0x22,0x08,0x44,0x0E,0x85,0x00,0x11,0x40,0x70,0x04,
+     0x01,0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x1F,0x84,
+     0x00,0x12,0x01,0xE0,0x84,0x40,0x90,0x24,0x08,0x02,0x01,0x00,0x80,0x40,0x20,0x10,
+     0x08,0x24,0x09,0x04,0x7F,0x84,0x00,0x12,0x01,0xE0,0x84,0x40,0x90,0x20,0x08,0x04,
+     0x1E,0x00,0x40,0x08,0x02,0x00,0x90,0x24,0x08,0x84,0x1E,0x85,0x00,0x12,0x10,0x0C,
+     0x03,0x01,0x40,0x50,0x24,0x09,0x04,0x41,0x10,0x84,0x21,0x1F,0xF0,0x10,0x04,0x03,
+     0x80,0x83,0x00,0x12,0x03,0xF8,0x80,0x20,0x08,0x02,0x00,0x80,0x3F,0x08,0x20,0x04,
+     0x01,0x00,0x50,0x14,0x04,0x82,0x1F,0x84,0x00,0x12,0x01,0xE0,0x84,0x40,0x90,0x24,
+     0x01,0x00,0x5E,0x18,0x44,0x09,0x02,0x40,0x90,0x24,0x08,0x84,0x1E,0x84,0x00,0x12,
+     0x03,0xF8,0x82,0x40,0x90,0x40,0x10,0x04,0x02,0x00,0x80,0x20,0x10,0x04,0x01,0x00,
+     0x40,0x10,0x04,0x84,0x00,0x12,0x01,0xE0,0x84,0x40,0x90,0x24,0x08,0x84,0x1E,0x08,
+     0x44,0x09,0x02,0x40,0x90,0x24,0x08,0x84,0x1E,0x84,0x00,0x12,0x01,0xE0,0x84,0x40,
+     0x90,0x24,0x09,0x02,0x40,0x88,0x61,0xE8,0x02,0x00,0x80,0x24,0x08,0x84,0x1E,0x88,
+     0x00,0x02,0x03,0x00,0xC0,0x85,0x00,0x02,0x03,0x00,0xC0,0x8A,0x00,0x02,0x03,0x00,
+     0xC0,0x85,0x00,0x04,0x03,0x00,0xC0,0x10,0x08,0x8A,0x00,0x82,0x0C,0x06,0x04,0x00,
+     0xC0,0x0C,0x00,0xC0,0x0C,0x8E,0x00,0x01,0x7F,0xC0,0x81,0x00,0x01,0x7F,0xC0,0x8D,
+     0x00,0x06,0x06,0x00,0x60,0x06,0x00,0x60,0x04,0x82,0x06,0x87,0x00,0x0E,0x01,0xE0,
+     0x84,0x40,0x90,0x24,0x08,0x02,0x01,0x00,0x80,0x40,0x20,0x08,0x02,0x81,0x00,0x01,
+     0x08,0x02,0x84,0x00,0x11,0xF0,0x42,0x20,0x48,0x14,0x55,0x2D,0x49,0x54,0x55,0x25,
+     0x49,0x52,0x53,0x64,0x00,0x82,0x1F,0x85,0x00,0x12,0x40,0x10,0x04,0x02,0x80,0xA0,
+     0x28,0x11,0x04,0x41,0x10,0x7C,0x20,0x88,0x22,0x08,0x82,0x71,0xC0,0x83,0x00,0x12,
+     0x07,0xF0,0x82,0x20,0x48,0x12,0x04,0x82,0x3F,0x08,0x22,0x04,0x81,0x20,0x48,0x12,
+     0x04,0x82,0x7F,0x85,0x00,0x11,0xE8,0x46,0x20,0x48,0x14,0x01,0x00,0x40,0x10,0x04,
+     0x01,0x00,0x40,0x08,0x12,0x04,0x42,0x0F,0x84,0x00,0x12,0x07,0xE0,0x84,0x20,0x88,
+     0x22,0x04,0x81,0x20,0x48,0x12,0x04,0x81,0x20,0x48,0x22,0x08,0x84,0x7E,0x84,0x00,
+     0x13,0x07,0xF8,0x82,0x20,0x48,0x02,0x00,0x84,0x21,0x0F,0xC2,0x10,0x84,0x20,0x08,
+     0x02,0x04,0x82,0x7F,0x80,0x83,0x00,0x12,0x07,0xF8,0x82,0x20,0x48,0x02,0x00,0x84,
+     0x21,0x0F,0xC2,0x10,0x84,0x20,0x08,0x02,0x00,0x80,0x70,0x85,0x00,0x12,0xE8,0x46,
+     0x20,0x48,0x14,0x01,0x00,0x40,0x10,0xF4,0x09,0x02,0x40,0x88,0x22,0x08,0x46,0x0E,
+     0x80,0x83,0x00,0x13,0x07,0x1C,0x82,0x20,0x88,0x22,0x08,0x82,0x3F,0x88,0x22,0x08,
+     0x82,0x20,0x88,0x22,0x08,0x82,0x71,0xC0,0x83,0x00,0x12,0x01,0xF0,0x10,0x04,0x01,
+     0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x1F,0x85,0x00,
+     0x11,0xF8,0x08,0x02,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x02,0x00,0x82,
+     0x20,0x88,0x1C,0x84,0x00,0x13,0x07,0x1C,0x82,0x21,0x08,0x82,0x40,0xA0,0x34,0x09,
+     0x02,0x20,0x88,0x21,0x08,0x42,0x08,0x82,0x71,0xC0,0x83,0x00,0x13,0x07,0x00,0x80,
+     0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x12,0x04,0x82,0x7F,
+     0x80,0x83,0x00,0x13,0x06,0x0C,0x82,0x31,0x8C,0x63,0x18,0xAA,0x2A,0x8A,0xA2,0x48,
+     0x92,0x24,0x88,0x22,0x08,0x82,0x71,0xC0,0x83,0x00,0x13,0x06,0x1C,0x82,0x30,0x8C,
+     0x22,0x88,0xA2,0x24,0x89,0x22,0x28,0x8A,0x21,0x88,0x62,0x08,0x82,0x70,0x80,0x84,
+     0x00,0x11,0xE0,0x44,0x20,0x88,0x24,0x05,0x01,0x40,0x50,0x14,0x05,0x01,0x40,0x48,
+     0x22,0x08,0x44,0x0E,0x84,0x00,0x12,0x07,0xF0,0x82,0x20,0x48,0x12,0x04,0x81,0x20,
+     0x48,0x23,0xF0,0x80,0x20,0x08,0x02,0x00,0x80,0x70,0x85,0x00,0x12,0xE0,0x44,0x20,
+     0x88,0x24,0x05,0x01,0x40,0x50,0x14,0x05,0x01,0x40,0x4B,0xA3,0x18,0x44,0x0E,0xC0,
+     0x83,0x00,0x13,0x07,0xE0,0x84,0x20,0x88,0x22,0x08,0x82,0x21,0x0F,0x82,0x10,0x82,
+     0x20,0x88,0x22,0x08,0x82,0x70,0xC0,0x83,0x00,0x12,0x01,0xE8,0x86,0x40,0xD0,0x14,
+     0x04,0x80,0x1C,0x00,0xC0,0x08,0x01,0x40,0x50,0x16,0x04,0xC2,0x2F,0x84,0x00,0x12,
+     0x03,0xF8,0x92,0x44,0x51,0x10,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x00,
+     0x40,0x10,0x1F,0x84,0x00,0x12,0x07,0x1C,0x82,0x20,0x88,0x22,0x08,0x82,0x20,0x88,
+     0x22,0x08,0x82,0x20,0x88,0x22,0x08,0x44,0x0E,0x84,0x00,0x12,0x07,0x1C,0x82,0x20,
+     0x88,0x22,0x08,0x82,0x11,0x04,0x41,0x10,0x28,0x0A,0x02,0x80,0x40,0x10,0x04,0x84,
+     0x00,0x12,0x07,0x5C,0x92,0x24,0x89,0x22,0x48,0xAA,0x2A,0x8A,0xA2,0xA8,0xAA,0x11,
+     0x04,0x41,0x10,0x44,0x11,0x84,0x00,0x13,0x07,0x1C,0x82,0x20,0x84,0x41,0x10,0x28,
+     0x0A,0x01,0x00,0xA0,0x28,0x11,0x04,0x42,0x08,0x82,0x71,0xC0,0x83,0x00,0x12,0x07,
+     0x1C,0x82,0x20,0x84,0x41,0x10,0x44,0x0A,0x02,0x80,0x40,0x10,0x04,0x01,0x00,0x40,
+     0x10,0x1F,0x84,0x00,0x13,0x03,0xFC,0x82,0x41,0x10,0x40,0x20,0x08,0x04,0x01,0x00,
+     0x80,0x20,0x10,0x04,0x12,0x04,0x82,0x7F,0x80,0x82,0x00,0x15,0x07,0x81,0x00,0x40,
+     0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,
+     0x07,0x80,0x82,0x00,0x14,0x04,0x01,0x00,0x20,0x08,0x01,0x00,0x40,0x08,0x02,0x00,
+     0x40,0x10,0x02,0x00,0x80,0x10,0x04,0x00,0x80,0x20,0x81,0x00,0x15,0x03,0xC0,0x10,
+     0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x04,
+     0x01,0x03,0xC0,0x81,0x00,0x05,0x03,0x01,0x20,0x84,0x40,0x80,0xA6,0x00,0x07,0x07,
+     0xFC,0x00,0x00,0x04,0x00,0x80,0x10,0x9B,0x00,0x0C,0x78,0x21,0x00,0x20,0x08,0x7E,
+     0x20,0x90,0x24,0x08,0x86,0x1E,0xC0,0x83,0x00,0x12,0x06,0x00,0x80,0x20,0x08,0x02,
+     0x00,0xBC,0x30,0x88,0x12,0x04,0x81,0x20,0x48,0x12,0x04,0xC2,0x2F,0x8B,0x00,0x0B,
+     0x78,0x21,0x10,0x24,0x01,0x00,0x40,0x10,0x04,0x08,0x84,0x1E,0x85,0x00,0x12,0x18,
+     0x02,0x00,0x80,0x20,0x08,0x7A,0x21,0x90,0x24,0x09,0x02,0x40,0x90,0x24,0x08,0x86,
+     0x1E,0xC0,0x8A,0x00,0x0B,0x78,0x21,0x10,0x24,0x09,0xFE,0x40,0x10,0x04,0x08,0x84,
+     0x1E,0x85,0x00,0x11,0x60,0x24,0x08,0x02,0x00,0x81,0xFC,0x08,0x02,0x00,0x80,0x20,
+     0x08,0x02,0x00,0x80,0x20,0x3E,0x8B,0x00,0x0E,0x7B,0x21,0x08,0x42,0x10,0x84,0x5E,
+     0x10,0x03,0xF1,0x02,0x40,0x90,0x23,0xF0,0x81,0x00,0x13,0x06,0x00,0x80,0x20,0x08,
+     0x02,0x00,0xB8,0x31,0x08,0x22,0x08,0x82,0x20,0x88,0x22,0x08,0x82,0x71,0xC0,0x84,
+     0x00,0x01,0x40,0x10,0x82,0x00,0x0B,0x30,0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x00,
+     0x40,0x10,0x0E,0x85,0x00,0x01,0x40,0x10,0x82,0x00,0x0E,0x30,0x04,0x01,0x00,0x40,
+     0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x11,0x03,0x80,0x81,0x00,0x13,0x06,0x00,0x80,
+     0x20,0x08,0x02,0x00,0x8E,0x21,0x08,0x82,0x40,0xA0,0x38,0x09,0x02,0x20,0x84,0x73,
+     0x80,0x84,0x00,0x11,0xC0,0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,
+     0x04,0x01,0x00,0x40,0x10,0x0E,0x8B,0x00,0x0C,0xAC,0x74,0x89,0x22,0x48,0x92,0x24,
+     0x89,0x22,0x48,0x92,0x7F,0xC0,0x8A,0x00,0x0C,0xB8,0x71,0x08,0x42,0x10,0x84,0x21,
+     0x08,0x42,0x10,0x84,0x73,0x80,0x8A,0x00,0x0B,0x78,0x21,0x10,0x24,0x09,0x02,0x40,
+     0x90,0x24,0x08,0x84,0x1E,0x8A,0x00,0x0E,0x01,0xBC,0x30,0x88,0x12,0x04,0x81,0x20,
+     0x48,0x13,0x08,0xBC,0x20,0x08,0x07,0x89,0x00,0x0E,0x7A,0x21,0x90,0x24,0x09,0x02,
+     0x40,0x90,0x22,0x18,0x7A,0x00,0x80,0x20,0x1C,0x88,0x00,0x0B,0xDC,0x18,0x84,0x01,
+     0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x38,0x8B,0x00,0x0B,0x7A,0x21,0x90,0x22,0x00,
+     0x70,0x03,0x00,0x24,0x09,0x84,0x5E,0x86,0x00,0x10,0x20,0x08,0x02,0x00,0x80,0xFC,
+     0x08,0x02,0x00,0x80,0x20,0x08,0x02,0x00,0x80,0x24,0x06,0x8A,0x00,0x0D,0x01,0x86,
+     0x20,0x88,0x22,0x08,0x82,0x20,0x88,0x22,0x08,0x86,0x1E,0xC0,0x89,0x00,0x0C,0x01,
+     0xC7,0x20,0x88,0x21,0x10,0x44,0x11,0x02,0x80,0xA0,0x10,0x04,0x8A,0x00,0x0C,0x01,
+     0xC7,0x24,0x89,0x22,0x48,0xAA,0x2A,0x8C,0x61,0x10,0x44,0x11,0x8A,0x00,0x0D,0x01,
+     0xC7,0x20,0x84,0x40,0xA0,0x10,0x04,0x02,0x81,0x10,0x82,0x71,0xC0,0x89,0x00,0x0E,
+     0x01,0xC7,0x20,0x88,0x21,0x10,0x44,0x11,0x02,0x80,0xA0,0x10,0x04,0x12,0x03,0x89,
+     0x00,0x0B,0xFE,0x21,0x10,0x80,0x40,0x10,0x08,0x04,0x01,0x08,0x84,0x7F,0x83,0x00,
+     0x48,0x01,0x80,0x80,0x20,0x08,0x02,0x00,0x80,0x20,0x08,0x0C,0x00,0x80,0x20,0x08,
+     0x02,0x00,0x80,0x20,0x08,0x02,0x00,0x60,0x00,0x00,0x01,0x00,0x40,0x10,0x04,0x01,
+     0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x00,
+     0x40,0x00,0x00,0x06,0x00,0x40,0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x00,0xC0,0x40,
+     0x10,0x04,0x01,0x00,0x40,0x10,0x04,0x01,0x01,0x80,0x8A,0x00,0x02,0x0E,0x24,0x70,
+     0xA2,0x00
+   };
+
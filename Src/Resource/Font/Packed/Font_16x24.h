@@ -0,0 +1,148 @@
+
+
+// Source: Font_16x24.bin (packed, 4613 -> 2218 byte)
+
+
+ static const BYTE fontFont_16x24_packed[2218] PROGMEM
+ = {
+     0x52,0x4C,0x45,0x01,0x05,0x12,0x00,0x00,0x04,0x20,0x7F,0x30,0x10,0x18,0xB6,0x00,
+     0x0E,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,
+     0x83,0x00,0x02,0x02,0x00,0x02,0x97,0x00,0x09,0x08,0x80,0x08,0x80,0x08,0x80,0x08,
+     0x80,0x08,0x80,0xA4,0x00,0x16,0x04,0x40,0x04,0x40,0x04,0x40,0x1F,0xE0,0x08,0x80,
+     0x08,0x80,0x08,0x80,0x08,0x80,0x3F,0xC0,0x11,0x00,0x11,0x00,0x11,0x95,0x00,0x1C,
+     0x02,0x00,0x02,0x00,0x0F,0x40,0x10,0xC0,0x10,0x40,0x10,0x00,0x08,0x00,0x07,0x00,
+     0x00,0x80,0x00,0x40,0x10,0x40,0x18,0x40,0x17,0x80,0x02,0x00,0x02,0x93,0x00,0x17,
+     0x38,0x00,0x44,0x20,0x44,0x40,0x44,0x80,0x39,0x00,0x02,0x00,0x02,0x00,0x04,0xE0,
+     0x09,0x10,0x11,0x10,0x21,0x10,0x00,0xE0,0x96,0x00,0x17,0x0F,0x00,0x10,0x80,0x10,
+     0x00,0x10,0x00,0x08,0x00,0x14,0x00,0x12,0x00,0x21,0x20,0x20,0xA0,0x20,0x40,0x20,
+     0xA0,0x1F,0x10,0x96,0x00,0x08,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0xA5,
+     0x00,0x1C,0x01,0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
+     0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x02,0x00,0x02,0x00,0x01,0x91,
+     0x00,0x1C,0x04,0x00,0x02,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+     0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x04,0x91,
+     0x00,0x0B,0x02,0x00,0x12,0x40,0x0F,0x80,0x07,0x00,0x05,0x00,0x08,0x80,0xA6,0x00,
+     0x10,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x3F,0xE0,0x02,0x00,0x02,0x00,0x02,
+     0x00,0x02,0xAD,0x00,0x04,0x02,0x00,0x02,0x00,0x04,0xA3,0x00,0x01,0x3F,0xE0,0xB2,
+     0x00,0x02,0x02,0x00,0x02,0x9A,0x00,0x13,0x10,0x00,0x20,0x00,0x40,0x00,0x80,0x01,
+     0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x97,0x00,0x16,0x07,
+     0x00,0x08,0x80,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,
+     0x40,0x10,0x40,0x08,0x80,0x07,0x97,0x00,0x17,0x06,0x00,0x1A,0x00,0x02,0x00,0x02,
+     0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x1F,
+     0xC0,0x96,0x00,0x17,0x07,0x00,0x08,0x80,0x10,0x40,0x00,0x40,0x00,0x40,0x00,0x80,
+     0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x40,0x10,0x40,0x1F,0xC0,0x96,0x00,0x16,0x0F,
+     0x00,0x10,0x80,0x00,0x40,0x00,0x40,0x00,0x80,0x03,0x00,0x00,0x80,0x00,0x40,0x00,
+     0x40,0x00,0x40,0x10,0x80,0x0F,0x98,0x00,0x16,0x80,0x01,0x80,0x01,0x80,0x02,0x80,
+     0x04,0x80,0x04,0x80,0x08,0x80,0x10,0x80,0x1F,0xC0,0x00,0x80,0x00,0x80,0x03,0xC0,
+     0x96,0x00,0x16,0x1F,0x80,0x10,0x00,0x10,0x00,0x10,0x00,0x1F,0x00,0x10,0x80,0x00,
+     0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x10,0x80,0x0F,0x97,0x00,0x16,0x01,0xC0,0x06,
+     0x00,0x08,0x00,0x08,0x00,0x10,0x00,0x17,0x00,0x18,0x80,0x10,0x40,0x10,0x40,0x10,
+     0x40,0x08,0x80,0x07,0x97,0x00,0x16,0x1F,0xC0,0x10,0x40,0x10,0x40,0x00,0x80,0x00,
+     0x80,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x04,0x97,0x00,
+     0x16,0x07,0x00,0x08,0x80,0x10,0x40,0x10,0x40,0x08,0x80,0x07,0x00,0x08,0x80,0x10,
+     0x40,0x10,0x40,0x10,0x40,0x08,0x80,0x07,0x97,0x00,0x16,0x07,0x00,0x08,0x80,0x10,
+     0x40,0x10,0x40,0x10,0x40,0x08,0xC0,0x07,0x40,0x00,0x40,0x00,0x80,0x00,0x80,0x03,
+     0x00,0x1C,0x9D,0x00,0x02,0x02,0x00,0x02,0x89,0x00,0x02,0x02,0x00,0x02,0x9D,0x00,
+     0x02,0x02,0x00,0x02,0x89,0x00,0x04,0x02,0x00,0x02,0x00,0x04,0x9A,0x00,0x10,0x80,
+     0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x01,0x00,0x00,0x80,
+     0xA0,0x00,0x01,0x3F,0xE0,0x84,0x00,0x01,0x3F,0xE0,0xA0,0x00,0x10,0x08,0x00,0x04,
+     0x00,0x02,0x00,0x01,0x00,0x00,0x80,0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x99,0x00,
+     0x0E,0x0F,0x80,0x10,0x40,0x10,0x40,0x00,0x40,0x00,0x80,0x01,0x00,0x02,0x00,0x02,
+     0x83,0x00,0x02,0x02,0x00,0x02,0x97,0x00,0x03,0x0F,0x80,0x10,0x40,0x82,0x20,0x13,
+     0x23,0xE0,0x24,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x23,0xE0,0x20,0x00,
+     0x10,0x00,0x0F,0x80,0x92,0x00,0x11,0x0E,0x00,0x02,0x00,0x02,0x00,0x05,0x00,0x05,
+     0x00,0x08,0x80,0x08,0x80,0x10,0x40,0x1F,0xC0,0x82,0x20,0x80,0x70,0x96,0x00,0x0D,
+     0x7F,0x80,0x10,0x40,0x10,0x20,0x10,0x20,0x10,0x40,0x1F,0xC0,0x10,0x20,0x85,0x10,
+     0x02,0x20,0x7F,0xC0,0x96,0x00,0x17,0x07,0xD0,0x18,0x30,0x10,0x10,0x20,0x00,0x20,
+     0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x10,0x10,0x18,0x30,0x07,0xC0,0x96,
+     0x00,0x05,0x7F,0x80,0x10,0x60,0x10,0x20,0x8B,0x10,0x04,0x20,0x10,0x60,0x7F,0x80,
+     0x96,0x00,0x17,0x7F,0xE0,0x10,0x20,0x10,0x20,0x10,0x00,0x10,0x80,0x1F,0x80,0x10,
+     0x80,0x10,0x00,0x10,0x00,0x10,0x20,0x10,0x20,0x7F,0xE0,0x96,0x00,0x16,0x3F,0xF0,
+     0x08,0x10,0x08,0x10,0x08,0x00,0x08,0x40,0x0F,0xC0,0x08,0x40,0x08,0x00,0x08,0x00,
+     0x08,0x00,0x08,0x00,0x3F,0x97,0x00,0x10,0x0F,0xA0,0x30,0x60,0x20,0x20,0x40,0x00,
+     0x40,0x00,0x40,0x00,0x41,0xF0,0x40,0x20,0x40,0x81,0x20,0x03,0x30,0x60,0x0F,0x80,
+     0x96,0x00,0x80,0x70,0x86,0x20,0x01,0x3F,0xE0,0x88,0x20,0x80,0x70,0x96,0x00,0x17,
+     0x1F,0xC0,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+     0x02,0x00,0x02,0x00,0x02,0x00,0x1F,0xC0,0x96,0x00,0x16,0x07,0xE0,0x00,0x80,0x00,
+     0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x20,0x80,0x20,
+     0x80,0x1F,0x97,0x00,0x17,0x71,0xE0,0x20,0x80,0x21,0x00,0x22,0x00,0x24,0x00,0x28,
+     0x00,0x34,0x00,0x22,0x00,0x21,0x00,0x20,0x80,0x20,0x40,0x70,0x30,0x96,0x00,0x17,
+     0x7E,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,
+     0x10,0x00,0x10,0x20,0x10,0x20,0x7F,0xE0,0x96,0x00,0x10,0x60,0x30,0x30,0x60,0x30,
+     0x60,0x28,0xA0,0x28,0xA0,0x25,0x20,0x25,0x20,0x22,0x20,0x22,0x83,0x20,0x80,0x70,
+     0x96,0x00,0x17,0x60,0xF0,0x30,0x20,0x30,0x20,0x28,0x20,0x24,0x20,0x22,0x20,0x22,
+     0x20,0x21,0x20,0x20,0xA0,0x20,0x60,0x20,0x60,0x78,0x20,0x96,0x00,0x17,0x0F,0x80,
+     0x30,0x60,0x20,0x20,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,
+     0x20,0x20,0x30,0x60,0x0F,0x80,0x96,0x00,0x16,0x7F,0x80,0x10,0x40,0x10,0x20,0x10,
+     0x20,0x10,0x20,0x10,0x40,0x1F,0x80,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x7E,
+     0x97,0x00,0x1D,0x0F,0x80,0x30,0x60,0x20,0x20,0x40,0x10,0x40,0x10,0x40,0x10,0x40,
+     0x10,0x40,0x10,0x40,0x10,0x20,0x20,0x30,0x60,0x0F,0x80,0x08,0x00,0x1C,0x40,0x23,
+     0x80,0x90,0x00,0x17,0x7F,0x80,0x10,0x40,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x40,
+     0x1F,0x80,0x11,0x00,0x10,0x80,0x10,0x40,0x10,0x20,0x7C,0x10,0x96,0x00,0x03,0x0F,
+     0xA0,0x10,0x60,0x81,0x20,0x09,0x00,0x10,0x00,0x0E,0x00,0x01,0x80,0x00,0x40,0x00,
+     0x81,0x20,0x03,0x30,0x40,0x2F,0x80,0x96,0x00,0x17,0x7F,0xF0,0x42,0x10,0x42,0x10,
+     0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+     0x0F,0x80,0x96,0x00,0x80,0x70,0x90,0x20,0x03,0x10,0x40,0x0F,0x80,0x96,0x00,0x80,
+     0x70,0x82,0x20,0x10,0x10,0x40,0x10,0x40,0x08,0x80,0x08,0x80,0x08,0x80,0x05,0x00,
+     0x05,0x00,0x02,0x00,0x02,0x97,0x00,0x17,0x60,0x30,0x40,0x10,0x40,0x10,0x42,0x10,
+     0x42,0x10,0x25,0x20,0x25,0x20,0x28,0xA0,0x28,0xA0,0x10,0x40,0x10,0x40,0x10,0x40,
+     0x96,0x00,0x17,0x78,0xF0,0x20,0x20,0x10,0x40,0x08,0x80,0x05,0x00,0x02,0x00,0x02,
+     0x00,0x05,0x00,0x08,0x80,0x10,0x40,0x20,0x20,0x78,0xF0,0x96,0x00,0x80,0x70,0x82,
+     0x20,0x11,0x10,0x40,0x08,0x80,0x05,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+     0x02,0x00,0x0F,0x80,0x96,0x00,0x01,0x3F,0xE0,0x81,0x20,0x0D,0x40,0x00,0x80,0x01,
+     0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x81,0x20,0x01,0x3F,0xE0,0x96,
+     0x00,0x1D,0x07,0x80,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
+     0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x07,0x80,
+     0x92,0x00,0x15,0x40,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x01,
+     0x00,0x00,0x80,0x00,0x40,0x00,0x20,0x00,0x10,0x96,0x00,0x1C,0x0F,0x00,0x01,0x00,
+     0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+     0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x0F,0x8F,0x00,0x05,0x02,0x00,0x05,0x00,
+     0x08,0x80,0xC4,0x00,0x01,0xFF,0xF0,0x90,0x00,0x04,0x04,0x00,0x02,0x00,0x01,0xB1,
+     0x00,0x11,0x0F,0x80,0x10,0x40,0x00,0x40,0x07,0xC0,0x18,0x40,0x20,0x40,0x20,0x40,
+     0x20,0x40,0x1F,0xA0,0x94,0x00,0x19,0x30,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x17,
+     0x80,0x18,0x40,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x18,0x40,0x37,
+     0x80,0x9C,0x00,0x11,0x07,0xA0,0x08,0x60,0x10,0x20,0x10,0x00,0x10,0x00,0x10,0x00,
+     0x10,0x00,0x08,0x20,0x07,0xC0,0x95,0x00,0x18,0xC0,0x00,0x40,0x00,0x40,0x00,0x40,
+     0x0F,0x40,0x10,0xC0,0x20,0x40,0x20,0x40,0x20,0x40,0x20,0x40,0x20,0x40,0x10,0xC0,
+     0x0F,0x60,0x9C,0x00,0x03,0x0F,0x80,0x10,0x40,0x82,0x20,0x09,0x3F,0xE0,0x20,0x00,
+     0x20,0x20,0x10,0x40,0x0F,0x80,0x94,0x00,0x19,0x01,0xC0,0x02,0x00,0x02,0x00,0x02,
+     0x00,0x0F,0xC0,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,
+     0x00,0x0F,0xC0,0x9C,0x00,0x18,0x0F,0x60,0x10,0xC0,0x20,0x40,0x20,0x40,0x20,0x40,
+     0x20,0x40,0x20,0x40,0x10,0xC0,0x0F,0x40,0x00,0x40,0x00,0x40,0x00,0x80,0x1F,0x8D,
+     0x00,0x19,0x30,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x17,0x80,0x18,0x40,0x10,0x40,
+     0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x38,0xE0,0x94,0x00,0x02,0x02,
+     0x00,0x02,0x83,0x00,0x11,0x0E,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,
+     0x00,0x02,0x00,0x02,0x00,0x1F,0xC0,0x94,0x00,0x02,0x01,0x00,0x01,0x83,0x00,0x18,
+     0x1F,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,
+     0x01,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x1C,0x8D,0x00,0x19,0x30,0x00,0x10,0x00,
+     0x10,0x00,0x10,0x00,0x11,0xE0,0x10,0x80,0x11,0x00,0x12,0x00,0x16,0x00,0x19,0x00,
+     0x10,0x80,0x10,0x40,0x30,0x30,0x94,0x00,0x19,0x0E,0x00,0x02,0x00,0x02,0x00,0x02,
+     0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,
+     0x00,0x1F,0xC0,0x9C,0x00,0x11,0x6C,0xC0,0x33,0x20,0x22,0x20,0x22,0x20,0x22,0x20,
+     0x22,0x20,0x22,0x20,0x22,0x20,0x73,0x30,0x9C,0x00,0x11,0x37,0x80,0x18,0x40,0x10,
+     0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x38,0xE0,0x9C,0x00,0x03,
+     0x0F,0x80,0x10,0x40,0x88,0x20,0x03,0x10,0x40,0x0F,0x80,0x9C,0x00,0x18,0x37,0x80,
+     0x18,0x40,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x18,0x40,0x17,0x80,
+     0x10,0x00,0x10,0x00,0x10,0x00,0x3C,0x95,0x00,0x19,0x0F,0x60,0x10,0xC0,0x20,0x40,
+     0x20,0x40,0x20,0x40,0x20,0x40,0x20,0x40,0x10,0xC0,0x0F,0x40,0x00,0x40,0x00,0x40,
+     0x00,0x40,0x01,0xE0,0x94,0x00,0x10,0x3B,0xC0,0x0C,0x20,0x08,0x00,0x08,0x00,0x08,
+     0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x3F,0x9D,0x00,0x11,0x0F,0xA0,0x10,0x60,0x20,
+     0x20,0x10,0x00,0x0F,0x80,0x00,0x40,0x20,0x20,0x30,0x40,0x2F,0x80,0x96,0x00,0x17,
+     0x04,0x00,0x04,0x00,0x04,0x00,0x1F,0xC0,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,
+     0x04,0x00,0x04,0x40,0x04,0x40,0x03,0x80,0x9C,0x00,0x11,0x30,0xC0,0x10,0x40,0x10,
+     0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0xC0,0x0F,0x60,0x9C,0x00,0x80,
+     0x70,0x80,0x20,0x0C,0x10,0x40,0x10,0x40,0x08,0x80,0x08,0x80,0x05,0x00,0x05,0x00,
+     0x02,0x9D,0x00,0x80,0x70,0x80,0x20,0x0D,0x22,0x20,0x22,0x20,0x15,0x40,0x15,0x40,
+     0x08,0x80,0x08,0x80,0x08,0x80,0x9C,0x00,0x11,0x78,0xF0,0x10,0x40,0x08,0x80,0x05,
+     0x00,0x02,0x00,0x05,0x00,0x08,0x80,0x10,0x40,0x78,0xF0,0x9C,0x00,0x80,0x70,0x80,
+     0x20,0x14,0x10,0x40,0x10,0x40,0x08,0x80,0x08,0x80,0x05,0x00,0x05,0x00,0x02,0x00,
+     0x02,0x00,0x04,0x00,0x04,0x00,0x1E,0x95,0x00,0x11,0x3F,0xE0,0x20,0x40,0x20,0x80,
+     0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x20,0x10,0x20,0x3F,0xE0,0x96,0x00,0x1D,0x01,
+     0x80,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x0C,0x00,0x02,
+     0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0x80,0x90,0x00,0x1E,
+     0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+     0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x8F,
+     0x00,0x1C,0x0C,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,
+     0x01,0x80,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x0C,0x8F,
+     0x00,0x05,0x1C,0x20,0x22,0x20,0x21,0xC0,0xD2,0x00
+   };
+
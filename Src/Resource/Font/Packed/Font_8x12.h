@@ -0,0 +1,67 @@
+
+
+// Source: Font_8x12.bin (packed, 1157 -> 920 byte)
+
+
+ static const BYTE fontFont_8x12_packed[920] PROGMEM
+ = {
+     0x52,0x4C,0x45,0x01,0x85,0x04,0x00,0x00,0x04,0x20,0x7F,0x0C,0x08,0x0C,0x8B,0x00,
+     0x85,0x08,0x01,0x00,0x08,0x81,0x00,0x81,0x14,0x87,0x00,0x80,0x0A,0x00,0x3F,0x81,
+     0x14,0x02,0x7E,0x28,0x28,0x81,0x00,0x08,0x08,0x1C,0x22,0x20,0x1C,0x02,0x22,0x1C,
+     0x08,0x81,0x00,0x08,0x20,0x51,0x22,0x04,0x08,0x10,0x22,0x45,0x02,0x81,0x00,0x08,
+     0x18,0x20,0x20,0x10,0x30,0x49,0x4A,0x44,0x3B,0x81,0x00,0x81,0x08,0x87,0x00,0x02,
+     0x04,0x08,0x08,0x83,0x10,0x80,0x08,0x04,0x04,0x00,0x10,0x08,0x08,0x83,0x04,0x80,
+     0x08,0x00,0x10,0x81,0x00,0x04,0x36,0x1C,0x7F,0x1C,0x36,0x85,0x00,0x81,0x08,0x00,
+     0x7F,0x81,0x08,0x89,0x00,0x01,0x08,0x10,0x85,0x00,0x00,0x7F,0x8C,0x00,0x00,0x08,
+     0x82,0x00,0x06,0x01,0x02,0x04,0x08,0x10,0x20,0x40,0x82,0x00,0x00,0x1C,0x85,0x22,
+     0x00,0x1C,0x81,0x00,0x01,0x08,0x38,0x84,0x08,0x00,0x3E,0x81,0x00,0x08,0x1C,0x22,
+     0x02,0x02,0x04,0x08,0x10,0x20,0x3E,0x81,0x00,0x08,0x1C,0x22,0x02,0x02,0x0C,0x02,
+     0x02,0x22,0x1C,0x81,0x00,0x08,0x04,0x0C,0x0C,0x14,0x14,0x24,0x3E,0x04,0x0E,0x81,
+     0x00,0x00,0x3E,0x81,0x20,0x04,0x3C,0x02,0x02,0x22,0x1C,0x81,0x00,0x04,0x0C,0x10,
+     0x20,0x20,0x3C,0x81,0x22,0x00,0x1C,0x81,0x00,0x08,0x3E,0x22,0x02,0x04,0x04,0x08,
+     0x08,0x10,0x10,0x81,0x00,0x00,0x1C,0x81,0x22,0x00,0x1C,0x81,0x22,0x00,0x1C,0x81,
+     0x00,0x00,0x1C,0x81,0x22,0x04,0x1E,0x02,0x02,0x04,0x18,0x84,0x00,0x00,0x08,0x82,
+     0x00,0x00,0x08,0x84,0x00,0x00,0x08,0x82,0x00,0x01,0x08,0x10,0x82,0x00,0x06,0x04,
+     0x08,0x10,0x20,0x10,0x08,0x04,0x84,0x00,0x02,0x3E,0x00,0x3E,0x86,0x00,0x06,0x10,
+     0x08,0x04,0x02,0x04,0x08,0x10,0x81,0x00,0x08,0x1C,0x22,0x02,0x02,0x04,0x08,0x08,
+     0x00,0x08,0x81,0x00,0x02,0x1E,0x21,0x4D,0x81,0x55,0x02,0x4E,0x20,0x1C,0x81,0x00,
+     0x08,0x18,0x08,0x08,0x14,0x14,0x22,0x3E,0x22,0x77,0x81,0x00,0x00,0x7E,0x81,0x21,
+     0x00,0x3E,0x81,0x21,0x00,0x7E,0x81,0x00,0x01,0x1E,0x21,0x83,0x40,0x01,0x21,0x1E,
+     0x81,0x00,0x01,0x7C,0x22,0x83,0x21,0x01,0x22,0x7C,0x81,0x00,0x08,0x7F,0x21,0x20,
+     0x24,0x3C,0x24,0x20,0x21,0x7F,0x81,0x00,0x08,0x7F,0x21,0x20,0x24,0x3C,0x24,0x20,
+     0x20,0x78,0x81,0x00,0x01,0x1E,0x21,0x81,0x40,0x03,0x47,0x41,0x21,0x1E,0x81,0x00,
+     0x00,0x77,0x81,0x22,0x00,0x3E,0x81,0x22,0x00,0x77,0x81,0x00,0x00,0x3E,0x85,0x08,
+     0x00,0x3E,0x81,0x00,0x00,0x1E,0x83,0x04,0x80,0x44,0x00,0x38,0x81,0x00,0x08,0x73,
+     0x22,0x24,0x24,0x28,0x38,0x24,0x22,0x73,0x81,0x00,0x00,0x7C,0x84,0x10,0x01,0x11,
+     0x7F,0x81,0x00,0x08,0x63,0x22,0x36,0x36,0x2A,0x2A,0x22,0x22,0x77,0x81,0x00,0x08,
+     0x67,0x22,0x32,0x32,0x2A,0x26,0x26,0x22,0x72,0x81,0x00,0x01,0x1C,0x22,0x83,0x41,
+     0x01,0x22,0x1C,0x81,0x00,0x00,0x7E,0x81,0x21,0x00,0x3E,0x81,0x20,0x00,0x78,0x81,
+     0x00,0x01,0x1C,0x22,0x83,0x41,0x05,0x22,0x1C,0x1B,0x00,0x00,0x7E,0x81,0x21,0x04,
+     0x3E,0x24,0x24,0x22,0x73,0x81,0x00,0x08,0x3E,0x41,0x40,0x40,0x3E,0x01,0x01,0x41,
+     0x3E,0x81,0x00,0x01,0x7F,0x49,0x84,0x08,0x00,0x1C,0x81,0x00,0x00,0x77,0x85,0x22,
+     0x00,0x1C,0x81,0x00,0x00,0x77,0x81,0x22,0x81,0x14,0x80,0x08,0x81,0x00,0x00,0x77,
+     0x81,0x22,0x81,0x2A,0x80,0x14,0x81,0x00,0x08,0x77,0x22,0x14,0x14,0x08,0x14,0x14,
+     0x22,0x77,0x81,0x00,0x04,0x77,0x22,0x22,0x14,0x14,0x81,0x08,0x00,0x1C,0x81,0x00,
+     0x08,0x7F,0x42,0x04,0x04,0x08,0x10,0x10,0x21,0x7F,0x81,0x00,0x00,0x1C,0x87,0x10,
+     0x09,0x1C,0x00,0x00,0x40,0x20,0x10,0x08,0x04,0x02,0x01,0x82,0x00,0x00,0x1C,0x87,
+     0x04,0x03,0x1C,0x08,0x14,0x22,0x92,0x00,0x03,0xFF,0x00,0x10,0x08,0x8B,0x00,0x05,
+     0x3C,0x02,0x3E,0x42,0x42,0x3D,0x81,0x00,0x03,0x60,0x20,0x20,0x3E,0x82,0x21,0x00,
+     0x7E,0x84,0x00,0x05,0x3E,0x41,0x40,0x40,0x41,0x3E,0x81,0x00,0x03,0x06,0x02,0x02,
+     0x3E,0x82,0x42,0x00,0x3F,0x84,0x00,0x05,0x3E,0x41,0x7F,0x40,0x41,0x3E,0x81,0x00,
+     0x03,0x0C,0x10,0x10,0x3C,0x82,0x10,0x00,0x3C,0x84,0x00,0x00,0x3F,0x81,0x42,0x09,
+     0x3E,0x02,0x02,0x3C,0x00,0x60,0x20,0x20,0x2C,0x32,0x81,0x22,0x00,0x77,0x81,0x00,
+     0x03,0x08,0x00,0x00,0x38,0x82,0x08,0x00,0x3E,0x81,0x00,0x03,0x04,0x00,0x00,0x3C,
+     0x84,0x04,0x0A,0x38,0x00,0x60,0x20,0x20,0x26,0x24,0x28,0x38,0x24,0x63,0x81,0x00,
+     0x00,0x18,0x85,0x08,0x00,0x3E,0x84,0x00,0x00,0x74,0x82,0x2A,0x00,0x6B,0x84,0x00,
+     0x01,0x6C,0x32,0x81,0x22,0x00,0x77,0x84,0x00,0x00,0x3E,0x82,0x41,0x00,0x3E,0x84,
+     0x00,0x00,0x7E,0x82,0x21,0x02,0x3E,0x20,0x70,0x82,0x00,0x00,0x3F,0x82,0x42,0x02,
+     0x3E,0x02,0x07,0x82,0x00,0x01,0x76,0x19,0x81,0x10,0x00,0x7C,0x84,0x00,0x05,0x3E,
+     0x41,0x38,0x06,0x41,0x3E,0x82,0x00,0x80,0x10,0x00,0x3C,0x81,0x10,0x01,0x12,0x0C,
+     0x84,0x00,0x00,0x66,0x81,0x22,0x01,0x26,0x1B,0x84,0x00,0x05,0x77,0x22,0x22,0x14,
+     0x14,0x08,0x84,0x00,0x05,0x77,0x22,0x2A,0x2A,0x14,0x14,0x84,0x00,0x05,0x77,0x22,
+     0x1C,0x1C,0x22,0x77,0x84,0x00,0x07,0x77,0x22,0x22,0x14,0x14,0x08,0x08,0x30,0x82,
+     0x00,0x05,0x7E,0x44,0x08,0x10,0x22,0x7E,0x81,0x00,0x00,0x06,0x82,0x08,0x00,0x30,
+     0x82,0x08,0x00,0x06,0x8A,0x08,0x01,0x00,0x30,0x82,0x08,0x00,0x06,0x82,0x08,0x05,
+     0x30,0x00,0x00,0x31,0x49,0x46,0x91,0x00
+   };
+
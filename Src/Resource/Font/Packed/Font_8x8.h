@@ -0,0 +1,52 @@
+
+
+// Source: Font_8x8.bin (packed, 773 -> 676 byte)
+
+
+ static const BYTE fontFont_8x8_packed[676] PROGMEM
+ = {
+     0x52,0x4C,0x45,0x01,0x05,0x03,0x00,0x00,0x01,0x20,0x7F,0x81,0x08,0x87,0x00,0x82,
+     0x10,0x05,0x00,0x10,0x00,0x00,0x18,0x18,0x84,0x00,0x21,0x24,0x7F,0x24,0xFE,0x24,
+     0x24,0x00,0x08,0x3C,0x4A,0x3C,0x0A,0x4A,0x3C,0x08,0x00,0xE4,0xA8,0xF0,0x1F,0x29,
+     0x4F,0x00,0x00,0x7C,0x44,0x78,0x8A,0x86,0x7E,0x00,0x00,0x08,0x08,0x83,0x00,0x01,
+     0x08,0x10,0x82,0x20,0x03,0x10,0x08,0x20,0x10,0x82,0x08,0x01,0x10,0x20,0x81,0x00,
+     0x01,0x08,0x36,0x82,0x00,0x80,0x08,0x02,0x7F,0x08,0x08,0x86,0x00,0x01,0x18,0x08,
+     0x81,0x00,0x00,0x7E,0x88,0x00,0x14,0x10,0x00,0x00,0x02,0x04,0x08,0x10,0x20,0x40,
+     0x00,0x00,0x3C,0x66,0x42,0x42,0x66,0x3C,0x00,0x00,0x08,0x38,0x82,0x08,0x80,0x00,
+     0x40,0x3C,0x42,0x06,0x38,0x60,0x7E,0x00,0x00,0x3C,0x42,0x1C,0x02,0x42,0x3C,0x00,
+     0x00,0x0C,0x34,0x44,0xFE,0x04,0x04,0x00,0x00,0x3E,0x20,0x3C,0x02,0x22,0x3C,0x00,
+     0x00,0x3C,0x40,0x7C,0x42,0x42,0x3C,0x00,0x00,0x7E,0x04,0x08,0x10,0x10,0x20,0x00,
+     0x00,0x3C,0x42,0x3C,0x42,0x42,0x3C,0x00,0x00,0x3C,0x42,0x42,0x3E,0x06,0x7C,0x00,
+     0x00,0x10,0x81,0x00,0x00,0x10,0x81,0x00,0x00,0x18,0x81,0x00,0x01,0x18,0x08,0x81,
+     0x00,0x03,0x03,0x3C,0x30,0x0F,0x83,0x00,0x80,0x7E,0x83,0x00,0x03,0xC0,0x3C,0x0C,
+     0xF0,0x81,0x00,0x3A,0x3C,0x42,0x02,0x0C,0x10,0x10,0x00,0x00,0x1E,0x63,0x9D,0xA9,
+     0xBE,0xC4,0x78,0x00,0x18,0x18,0x24,0x7E,0x42,0x81,0x00,0x00,0x7C,0x42,0x7C,0x42,
+     0x41,0x7E,0x00,0x00,0x3C,0x62,0x40,0x40,0x61,0x3E,0x00,0x00,0x7C,0x46,0x42,0x42,
+     0x46,0x7C,0x00,0x00,0x7E,0x40,0x7E,0x40,0x40,0x7E,0x00,0x00,0x7E,0x40,0x7E,0x81,
+     0x40,0x80,0x00,0x0A,0x3C,0x62,0x40,0x4E,0x62,0x3E,0x00,0x00,0x42,0x42,0x7E,0x81,
+     0x42,0x80,0x00,0x84,0x10,0x80,0x00,0x82,0x02,0x0B,0x42,0x3C,0x00,0x00,0x46,0x48,
+     0x50,0x68,0x44,0x42,0x00,0x00,0x83,0x40,0x02,0x7E,0x00,0x00,0x81,0x66,0x81,0x5A,
+     0x80,0x00,0x80,0x62,0x20,0x52,0x4A,0x46,0x46,0x00,0x00,0x3C,0x66,0x42,0x42,0x66,
+     0x3C,0x00,0x00,0x7C,0x42,0x42,0x7C,0x40,0x40,0x00,0x00,0x3C,0x66,0x42,0x42,0x6A,
+     0x3C,0x02,0x00,0x7C,0x42,0x7E,0x81,0x42,0x80,0x00,0x08,0x3C,0x42,0x3C,0x03,0x41,
+     0x3E,0x00,0x00,0xFE,0x83,0x10,0x80,0x00,0x83,0x42,0x1D,0x3C,0x00,0x00,0x81,0x42,
+     0x44,0x24,0x38,0x10,0x00,0x00,0x91,0x92,0xBA,0x6A,0x24,0x24,0x00,0x00,0x44,0x28,
+     0x10,0x38,0x64,0xC2,0x00,0x00,0xC2,0x64,0x38,0x81,0x10,0x80,0x00,0x07,0xFE,0x04,
+     0x18,0x20,0x40,0xFE,0x00,0x38,0x84,0x20,0x09,0x38,0x00,0x40,0x20,0x10,0x08,0x04,
+     0x02,0x00,0x1C,0x84,0x04,0x04,0x1C,0x00,0x18,0x24,0xC3,0x89,0x00,0x02,0xFF,0x00,
+     0x10,0x87,0x00,0x03,0x7E,0x3E,0x42,0x3F,0x81,0x00,0x04,0x40,0x7C,0x42,0x42,0x7C,
+     0x82,0x00,0x03,0x3E,0x40,0x40,0x3E,0x81,0x00,0x04,0x02,0x3E,0x42,0x42,0x3E,0x82,
+     0x00,0x08,0x3C,0x42,0x7E,0x02,0x3C,0x00,0x1C,0x10,0x3C,0x81,0x10,0x81,0x00,0x09,
+     0x02,0x3E,0x46,0x72,0x0E,0x7C,0x00,0x40,0x40,0x7E,0x81,0x42,0x80,0x00,0x01,0x08,
+     0x00,0x82,0x08,0x80,0x00,0x01,0x08,0x00,0x82,0x08,0x09,0x18,0x00,0x40,0x40,0x44,
+     0x58,0x68,0x44,0x00,0x00,0x84,0x08,0x82,0x00,0x00,0x7E,0x81,0x4A,0x82,0x00,0x00,
+     0x7E,0x81,0x42,0x82,0x00,0x03,0x3C,0x42,0x42,0x3C,0x82,0x00,0x04,0x7C,0x42,0x42,
+     0x7C,0x40,0x81,0x00,0x04,0x3E,0x42,0x42,0x3E,0x02,0x81,0x00,0x00,0x3C,0x81,0x20,
+     0x81,0x00,0x04,0x1C,0x20,0x18,0x04,0x38,0x81,0x00,0x04,0x10,0x3C,0x10,0x10,0x1C,
+     0x82,0x00,0x81,0x42,0x00,0x3C,0x82,0x00,0x03,0x44,0x28,0x28,0x10,0x82,0x00,0x03,
+     0x99,0x9A,0x66,0x66,0x82,0x00,0x03,0x24,0x18,0x18,0x24,0x82,0x00,0x04,0x42,0x24,
+     0x28,0x10,0x70,0x81,0x00,0x0C,0x7E,0x08,0x30,0x7E,0x00,0x1C,0x10,0x30,0x60,0x60,
+     0x30,0x10,0x1C,0x86,0x08,0x07,0x38,0x08,0x0C,0x06,0x06,0x0C,0x08,0x38,0x81,0x00,
+     0x00,0x7E,0x8A,0x00
+   };
+
@@ -9,4 +9,12 @@ set EXE="%EMBSYSLIB%\Tools\Bmp2Font.exe"
 %EXE% -F Font_8x12    -w  8 -h 12 -f 32 -l 127
 %EXE% -F Font_8x8     -w  8 -h 8 -f 32 -l 127
 
+rem packed versions, see ../Pack/Pack.cpp
+set PACK="..\Pack\Pack.exe"
+
+%PACK% -F Font_10x20   -u 1 -n fontFont_10x20_packed
+%PACK% -F Font_16x24   -u 1 -n fontFont_16x24_packed
+%PACK% -F Font_8x12    -u 1 -n fontFont_8x12_packed
+%PACK% -F Font_8x8     -u 1 -n fontFont_8x8_packed
+
 echo.
@@ -0,0 +1,254 @@
+//*******************************************************************
+/*!
+\file   Pack.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Run length coder for font and bitmap resources
+*/
+
+//*******************************************************************
+/*
+Usage:    Pack -F name -u unitSize -n identifier [-o directory]
+
+          Reads name.bin (output of Bmp2Font or bmp2cpp), packs it and
+          writes directory/name.bin (for the image) and directory/name.h
+          (C array 'identifier'). Default directory is "Packed".
+          Use unitSize 1 for fonts and 2 for bitmaps (16 bit pixels),
+          the size of the input must be a multiple of unitSize.
+
+          The format is decoded by Src/Scope/PackedResource.cpp
+
+Build:    g++ -O2 -o Pack Pack.cpp
+*/
+
+//*******************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//*******************************************************************
+typedef unsigned char  BYTE;
+typedef unsigned short WORD;
+typedef unsigned int   DWORD;
+
+//*******************************************************************
+static const DWORD MAX_RUN     = 0x7F + 2;
+static const DWORD MAX_LITERAL = 0x7F + 1;
+
+//*******************************************************************
+class Packer
+{
+  public:
+    //---------------------------------------------------------------
+    Packer( const BYTE *dataIn, DWORD sizeIn, BYTE unitSizeIn )
+    {
+      data     = dataIn;
+      unitSize = unitSizeIn;
+      num      = sizeIn / unitSize;
+      out      = new BYTE[ 8 + sizeIn + sizeIn/MAX_LITERAL + 1 ];
+      outSize  = 0;
+    }
+
+    //---------------------------------------------------------------
+    ~Packer( void )
+    {
+      delete[] out;
+    }
+
+    //---------------------------------------------------------------
+    void pack( void )
+    {
+      DWORD size = num * unitSize;
+
+      put( 'R' );
+      put( 'L' );
+      put( 'E' );
+      put( unitSize );
+      put( size       & 0xFF );
+      put( size >>  8 & 0xFF );
+      put( size >> 16 & 0xFF );
+      put( size >> 24 & 0xFF );
+
+      DWORD i = 0;
+      while( i < num )
+      {
+        DWORD run = runLength( i );
+        if( run >= 2 )
+        {
+          put( 0x80 | (run - 2) );
+          putUnit( i );
+          i += run;
+          continue;
+        }
+
+        // literal units up to the next run, which is worth a token
+        DWORD first  = i;
+        DWORD minRun = ( unitSize == 1 ) ? 3 : 2;
+        while( i < num && i - first < MAX_LITERAL && runLength( i ) < minRun )
+        {
+          i++;
+        }
+        put( i - first - 1 );
+        for( DWORD k = first; k < i; k++ )
+        {
+          putUnit( k );
+        }
+      }
+    }
+
+    //---------------------------------------------------------------
+    bool writeBin( const char *fileName )
+    {
+      FILE *f = fopen( fileName, "wb" );
+      if( !f )
+      {
+        return( false );
+      }
+      fwrite( out, 1, outSize, f );
+      fclose( f );
+      return( true );
+    }
+
+    //---------------------------------------------------------------
+    bool writeHeader( const char *fileName,
+                      const char *source,
+                      const char *identifier )
+    {
+      FILE *f = fopen( fileName, "w" );
+      if( !f )
+      {
+        return( false );
+      }
+      fprintf( f, "\n\n// Source: %s (packed, %u -> %u byte)\n\n\n",
+               source, num * unitSize, outSize );
+      fprintf( f, " static const BYTE %s[%u] PROGMEM\n = {\n", identifier, outSize );
+      for( DWORD i = 0; i < outSize; i++ )
+      {
+        fprintf( f, "%s0x%02X%s", (i % 16 == 0) ? "     " : "",
+                                  out[i],
+                                  (i + 1 == outSize) ? "\n"
+                                : (i % 16 == 15)     ? ",\n"
+                                :                      "," );
+      }
+      fprintf( f, "   };\n\n" );
+      fclose( f );
+      return( true );
+    }
+
+    //---------------------------------------------------------------
+    DWORD getSize( void )
+    {
+      return( outSize );
+    }
+
+  private:
+    //---------------------------------------------------------------
+    DWORD runLength( DWORD i )
+    {
+      DWORD run = 1;
+      while(    i + run < num
+             && run < MAX_RUN
+             && !memcmp( &data[(i + run)*unitSize], &data[i*unitSize], unitSize ) )
+      {
+        run++;
+      }
+      return( run );
+    }
+
+    //---------------------------------------------------------------
+    void putUnit( DWORD i )
+    {
+      for( BYTE k = 0; k < unitSize; k++ )
+      {
+        put( data[i*unitSize + k] );
+      }
+    }
+
+    //---------------------------------------------------------------
+    void put( BYTE b )
+    {
+      out[outSize++] = b;
+    }
+
+  private:
+    //---------------------------------------------------------------
+    const BYTE *data;
+    BYTE        unitSize;
+    DWORD       num;
+    BYTE       *out;
+    DWORD       outSize;
+};
+
+//*******************************************************************
+int main( int argc, char *argv[] )
+{
+  const char *name       = 0;
+  const char *identifier = 0;
+  const char *directory  = "Packed";
+  int         unitSize   = 1;
+
+  for( int i = 1; i + 1 < argc; i += 2 )
+  {
+    if     ( !strcmp( argv[i], "-F" ) ) name       =       argv[i+1];
+    else if( !strcmp( argv[i], "-u" ) ) unitSize   = atoi( argv[i+1] );
+    else if( !strcmp( argv[i], "-n" ) ) identifier =       argv[i+1];
+    else if( !strcmp( argv[i], "-o" ) ) directory  =       argv[i+1];
+  }
+
+  if( !name || !identifier || ( unitSize != 1 && unitSize != 2 ) )
+  {
+    fprintf( stderr, "usage: Pack -F name -u 1|2 -n identifier [-o directory]\n" );
+    return( 1 );
+  }
+
+  char fileName[256];
+
+  snprintf( fileName, sizeof(fileName), "%s.bin", name );
+  FILE *f = fopen( fileName, "rb" );
+  if( !f )
+  {
+    fprintf( stderr, "Pack: can't open %s\n", fileName );
+    return( 1 );
+  }
+  fseek( f, 0, SEEK_END );
+  long size = ftell( f );
+  fseek( f, 0, SEEK_SET );
+
+  BYTE *data = new BYTE[ size ];
+  if( fread( data, 1, size, f ) != (size_t)size )
+  {
+    fprintf( stderr, "Pack: can't read %s\n", fileName );
+    return( 1 );
+  }
+  fclose( f );
+
+  if( size % unitSize != 0 )
+  {
+    fprintf( stderr, "Pack: size of %s is not a multiple of %d\n", fileName, unitSize );
+    return( 1 );
+  }
+
+  Packer packer( data, size, unitSize );
+  packer.pack();
+
+  snprintf( fileName, sizeof(fileName), "%s/%s.bin", directory, name );
+  if( !packer.writeBin( fileName ) )
+  {
+    fprintf( stderr, "Pack: can't write %s\n", fileName );
+    return( 1 );
+  }
+
+  char source[256];
+  snprintf( source, sizeof(source), "%s.bin", name );
+  snprintf( fileName, sizeof(fileName), "%s/%s.h", directory, name );
+  if( !packer.writeHeader( fileName, source, identifier ) )
+  {
+    fprintf( stderr, "Pack: can't write %s\n", fileName );
+    return( 1 );
+  }
+
+  printf( "%-16s %7ld -> %7u byte\n", name, size, packer.getSize() );
+
+  delete[] data;
+  return( 0 );
+}
@@ -0,0 +1,175 @@
+//*******************************************************************
+/*!
+\file   BulkLink.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Vendor specific USB bulk interface of the sample stream
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_BULK_LINK_H
+#define _SCOPE_BULK_LINK_H
+
+//*******************************************************************
+#include "Stream.h"
+
+//*******************************************************************
+/*!
+\class BulkLink
+
+\brief Sends the blocks of a Stream on a bulk IN endpoint
+
+Descriptor: see BulkLink/descriptor.txt (vendor class, WinUSB, bulk IN
+EP_IN and bulk OUT EP_OUT with 64 byte packets).
+
+The endpoint sends directly from the memory of a Stream block, nothing
+is copied. When a block is complete, the USB interrupt releases it and
+passes the next one, while the acquisition fills further blocks of the
+ring. A raw block of 2 channels is 1048 byte, a coded one is shorter.
+The last short packet ends a transfer on the host, a frame of a
+multiple of the packet size is followed by a zero length packet. So a
+host transfer of at least one block gets exactly one frame. Without a
+full block a zero length packet is sent and the host simply asks
+again.
+
+The host starts and stops the stream with one command byte on EP_OUT.
+*/
+class BulkLink : public USBdeviceInterface
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      EP_IN     = 0x81,
+      EP_OUT    = 0x02,
+      CMD_STOP  = 0,    //!< Command byte: stop the stream
+      CMD_START = 1     //!< Command byte: start with sequence number 0
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate the interface
+        \param usb      USB device
+        \param interfId Interface id of the descriptor
+        \param stream   Stream to be sent
+    */
+    BulkLink( USBdevice &usb, BYTE interfId, Stream &streamIn )
+
+    : USBdeviceInterface( usb, 1/*configId*/, interfId ),
+      stream( streamIn )
+
+    {
+      isSending    = false;
+      isZlpPending = false;
+      packetSize   = 64;
+    }
+
+  private:
+    //---------------------------------------------------------------
+    virtual void onConfigEndpoint( BYTE epId, DataPointer &data, WORD maxPacketSize )
+    {
+      if( epId == EP_IN )
+      {
+        packetSize = maxPacketSize;
+        data       = DataPointer( command, 0 );
+      }
+      else
+      {
+        data = DataPointer( command, sizeof( command ) );
+      }
+    }
+
+    //---------------------------------------------------------------
+    virtual bool onTransmit( BYTE epId, DataPointer &data )
+    {
+      // the last block is sent, the next one follows without a gap
+      if( isSending )
+      {
+        stream.releaseBlock();
+        isSending = false;
+      }
+
+      // a frame without a short packet has to be ended
+      if( isZlpPending )
+      {
+        isZlpPending = false;
+        data         = DataPointer( command, 0 );
+        return( true );
+      }
+
+      WORD        size;
+      const BYTE *block = stream.getBlock( size );
+
+      if( block )
+      {
+        data         = DataPointer( (BYTE *)block, size );
+        isSending    = true;
+        isZlpPending = ( size % packetSize == 0 );
+      }
+      else
+      {
+        data = DataPointer( command, 0 ); // zero length packet
+      }
+      return( true );
+    }
+
+    //---------------------------------------------------------------
+    virtual void onTransmitCtrl( void )
+    {
+    }
+
+    //---------------------------------------------------------------
+    virtual bool onReceive( BYTE epId, WORD cnt, DataPointer &data )
+    {
+      if( cnt > 0 )
+      {
+        // the frame being sent is finished, the blocks before the
+        // start are skipped by the next getBlock() of onTransmit()
+        if( command[0] == CMD_START )
+        {
+          stream.start();
+        }
+        else if( command[0] == CMD_STOP )
+        {
+          stream.stop();
+        }
+      }
+      data = DataPointer( command, sizeof( command ) );
+      return( true );
+    }
+
+    //---------------------------------------------------------------
+    virtual bool onReceiveCtrl( WORD cnt )
+    {
+      return( false );
+    }
+
+    //---------------------------------------------------------------
+    virtual bool onRequestCtrl_IN( DataPointer &data,
+                                   BYTE         request,
+                                   WORD         value,
+                                   WORD         length )
+    {
+      return( false );
+    }
+
+    //---------------------------------------------------------------
+    virtual bool onRequestCtrl_OUT( DataPointer &data,
+                                    BYTE         request,
+                                    WORD         value,
+                                    WORD         length )
+    {
+      return( false );
+    }
+
+  private:
+    //---------------------------------------------------------------
+    Stream        &stream;
+    BYTE           command[64];
+    volatile bool  isSending;
+    bool           isZlpPending; // zero length packet after the frame
+    WORD           packetSize;
+
+}; //BulkLink
+
+#endif
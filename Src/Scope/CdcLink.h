@@ -0,0 +1,112 @@
+//*******************************************************************
+/*!
+\file   CdcLink.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Stream link to the USB virtual COM port
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_CDC_LINK_H
+#define _SCOPE_CDC_LINK_H
+
+//*******************************************************************
+#include "Module/USB/USB_Uart.h"
+#include "Stream.h"
+
+using namespace EmbSysLib::Mod;
+
+//*******************************************************************
+/*!
+\class CdcLink
+
+\brief Passes the frames of a Stream to a USB_Uart (CDC)
+
+USB_Uart takes single bytes into its transmit fifo, which is sent by
+the USB interrupt in packets of USB_Uart::packetSize. The fifo does not
+report its free space and drops bytes put into a full fifo. So write()
+is paced like UartTx: update() is called by a timer interrupt and adds
+the bytes the host takes per cycle to a credit, write() accepts at most
+the credit. The credit is limited to the size of the fifo, then the
+fifo does not overrun as long as the host reads at least byteRate.
+A block not accepted stays in the Stream and is sent by the next
+write(), so the stream is lossless, if byteRate covers its data rate.
+
+The credit is counted by update() (granted) and write() (used) in two
+counters, each written by one context only, so no interrupt lock is
+needed.
+*/
+class CdcLink : public Stream::Link
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a link
+        \param cdc       Virtual COM port
+        \param fifoSize  Size of the transmit fifo of cdc [byte]
+        \param byteRate  Bytes per second taken by the host at least
+        \param cycleTime Period of update() [us]
+    */
+    CdcLink( USB_Uart &cdcIn, WORD fifoSizeIn, DWORD byteRate, DWORD cycleTime )
+
+    : cdc( cdcIn )
+
+    {
+      fifoSize = fifoSizeIn;
+      granted  = fifoSize;   // the fifo is empty at the start
+      used     = 0;
+      fraction = 0;
+      rate     = (DWORD)( (unsigned long long)byteRate * cycleTime * 65536
+                          / 1000000ULL );
+    }
+
+    //---------------------------------------------------------------
+    /*! Add the bytes sent by the host since the last call to the
+        credit, to be called by a timer interrupt every cycleTime
+    */
+    void update( void )
+    {
+      DWORD credit = granted - used;
+
+      if( credit < fifoSize )
+      {
+        fraction += rate;
+        credit   += fraction >> 16;
+        fraction &= 0xFFFF;
+        if( credit > fifoSize )
+        {
+          credit = fifoSize;
+        }
+        granted = used + credit;
+      }
+    }
+
+    //---------------------------------------------------------------
+    virtual WORD write( const BYTE *data, WORD size )
+    {
+      DWORD credit = granted - used;
+
+      if( size > credit )
+      {
+        size = credit;
+      }
+      for( WORD i = 0; i < size; i++ )
+      {
+        cdc.set( data[i] );
+      }
+      used += size;
+      return( size );
+    }
+
+  private:
+    //---------------------------------------------------------------
+    USB_Uart       &cdc;
+    DWORD           fifoSize;
+
+    volatile DWORD  granted;    // bytes allowed since the start, written by update() only
+    volatile DWORD  used;       // bytes accepted since the start, written by write() only
+    DWORD           fraction;   // of the next byte allowed, 16 bit fraction
+    DWORD           rate;       // bytes per cycle, 16.16 fixed point
+
+}; //CdcLink
+
+#endif
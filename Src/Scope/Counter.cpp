@@ -0,0 +1,131 @@
+//*******************************************************************
+/*!
+\file   Counter.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Reciprocal frequency counter in the sample stream
+*/
+
+//*******************************************************************
+#include "Counter.h"
+
+//*******************************************************************
+//
+// Counter
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Counter::Counter( WORD samplePeriodIn, DWORD gateIn )
+{
+  samplePeriod = samplePeriodIn;
+  gate         = ( gateIn > MAX_GATE ) ? (DWORD)MAX_GATE
+               : ( gateIn < 2 )        ? 2
+               :                         gateIn;
+
+  index      = 0;
+  prev       = 0;
+  minCode    = 0xFFFF;
+  maxCode    = 0;
+  lo         = mid = hi = 0;
+  isArmed    = false;
+  isHigh     = true;
+  tMid       = 0;
+  tFirst     = 0;
+  tLast      = 0;
+  edges      = 0;
+
+  span       = 0;
+  numOfEdges = 0;
+  isReady    = false;
+}
+
+//-------------------------------------------------------------------
+bool Counter::get( Result &result )
+{
+  if( !isReady )
+  {
+    return( false );
+  }
+
+  DWORD t = span;
+  DWORD n = numOfEdges;
+  isReady = false;
+
+  result.edges      = n;
+  result.frequency  = 0;
+  result.resolution = 0;
+
+  if( n >= 2 && t > 0 )
+  {
+    // f = (n-1) / (t/FRAC * samplePeriod) [mHz]
+    unsigned long long den = (unsigned long long)t * samplePeriod;
+
+    result.frequency  = (DWORD)( (unsigned long long)( n - 1 ) * FRAC * 1000000000ULL / den );
+
+    // an edge time is assumed to be accurate to 1/16 sample
+    result.resolution = (DWORD)( (unsigned long long)result.frequency * ( FRAC / 16 ) / t );
+    if( result.resolution == 0 )
+    {
+      result.resolution = 1;
+    }
+  }
+  return( true );
+}
+
+//-------------------------------------------------------------------
+void Counter::drawReadout( ScreenGraphic &screen,
+                           WORD           x,
+                           WORD           y,
+                           const Result  &result ) const
+{
+  if( result.frequency == 0 )
+  {
+    screen.drawText( x, y, "counter: no signal            " );
+    return;
+  }
+
+  // as many decimals as the resolution allows
+  DWORD hz  = result.frequency / 1000;
+  DWORD mHz = result.frequency % 1000;
+
+  if( result.resolution < 10 )
+  {
+    screen.drawText( x, y, "counter: %d.%03dHz   ", (int)hz, (int)mHz );
+  }
+  else if( result.resolution < 100 )
+  {
+    screen.drawText( x, y, "counter: %d.%02dHz   ", (int)hz, (int)( mHz / 10 ) );
+  }
+  else if( result.resolution < 1000 )
+  {
+    screen.drawText( x, y, "counter: %d.%dHz   ", (int)hz, (int)( mHz / 100 ) );
+  }
+  else
+  {
+    screen.drawText( x, y, "counter: %dHz   ", (int)hz );
+  }
+}
+
+//-------------------------------------------------------------------
+void Counter::finish( void )
+{
+  span       = ( edges >= 2 ) ? tLast - tFirst : 0;
+  numOfEdges = edges;
+  isReady    = true;
+
+  // levels of the next gate
+  WORD swing = maxCode - minCode;
+
+  isArmed = ( maxCode > minCode && swing >= MIN_SWING );
+  lo      = minCode + swing * 3 / 10;
+  mid     = minCode + swing / 2;
+  hi      = maxCode - swing * 3 / 10;
+  isHigh  = ( prev > mid );
+
+  index   = 0;
+  edges   = 0;
+  minCode = 0xFFFF;
+  maxCode = 0;
+}
+
+//EOF
@@ -0,0 +1,155 @@
+//*******************************************************************
+/*!
+\file   Counter.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Reciprocal frequency counter in the sample stream
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_COUNTER_H
+#define _SCOPE_COUNTER_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+
+using namespace EmbSysLib::Dev;
+
+//*******************************************************************
+/*!
+\class Counter
+
+\brief Frequency from the time of the first and the last rising edge
+       within a gate time
+
+Every sample of the acquisition is passed to add(), also while no
+capture is taken. A rising edge is counted, if the signal crosses the
+30% and then the 70% level. This narrow hysteresis still finds every
+edge of a sine with 3 samples per period. The edge time is the
+crossing of the 50% level, interpolated between the two samples. At
+the end of a gate
+  f = ( edges - 1 ) / ( tLast - tFirst )
+So the resolution is not limited to one period per gate, but grows
+with the gate time. The levels are taken from min/max of the previous
+gate.
+
+add() is called in the timer interrupt. Apart from one division per
+edge it costs a few compares, the frequency is calculated in get().
+*/
+class Counter
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Result of a gate
+    */
+    class Result
+    {
+      public:
+        DWORD frequency;  //!< [mHz], 0: no signal
+        DWORD resolution; //!< [mHz]
+        DWORD edges;      //!< Number of edges within the gate
+    };
+
+    //---------------------------------------------------------------
+    enum
+    {
+      MIN_SWING = 0x200, //!< Min. peak to peak [code]
+      FRAC      = 256,   //!< Sub-sample resolution of the edge time
+      MAX_GATE  = 0xFFFFFF //!< [samples], so the edge times fit into 32 bit
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a counter
+        \param samplePeriod Sample period [us]
+        \param gate         Gate time [samples], up to MAX_GATE
+    */
+    Counter( WORD samplePeriod, DWORD gate );
+
+    //---------------------------------------------------------------
+    /*! Process the next sample of the stream
+    */
+    inline void add( WORD code )
+    {
+      if( code < minCode ) minCode = code;
+      if( code > maxCode ) maxCode = code;
+
+      if( isArmed )
+      {
+        if( !isHigh )
+        {
+          if( prev < mid && code >= mid )
+          {
+            tMid = index * FRAC - FRAC + ( (DWORD)( mid - prev ) * FRAC ) / ( code - prev );
+          }
+          if( code >= hi ) // rising edge complete
+          {
+            if( edges == 0 )
+            {
+              tFirst = tMid;
+            }
+            tLast = tMid;
+            edges++;
+            isHigh = true;
+          }
+        }
+        else if( code <= lo )
+        {
+          isHigh = false;
+        }
+      }
+      prev = code;
+
+      if( ++index >= gate )
+      {
+        finish();
+      }
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the result of the last completed gate
+        \return true, if a new result is available
+    */
+    bool get( Result &result );
+
+    //---------------------------------------------------------------
+    /*! Print the last result
+    */
+    void drawReadout( ScreenGraphic &screen,
+                      WORD           x,
+                      WORD           y,
+                      const Result  &result ) const;
+
+  private:
+    //---------------------------------------------------------------
+    // end of a gate: take over the result and the levels of the next gate
+    void finish( void );
+
+  private:
+    //---------------------------------------------------------------
+    WORD  samplePeriod;
+    DWORD gate;
+
+    // actual gate
+    DWORD index;
+    WORD  prev;
+    WORD  minCode;
+    WORD  maxCode;
+    WORD  lo;
+    WORD  mid;
+    WORD  hi;
+    bool  isArmed; // levels are valid
+    bool  isHigh;
+    DWORD tMid;
+    DWORD tFirst;
+    DWORD tLast;
+    DWORD edges;
+
+    // last completed gate
+    volatile DWORD span;
+    volatile DWORD numOfEdges;
+    volatile bool  isReady;
+
+}; //Counter
+
+#endif
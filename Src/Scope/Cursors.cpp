@@ -0,0 +1,212 @@
+//*******************************************************************
+/*!
+\file   Cursors.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Touch draggable time and voltage cursors with readout
+*/
+
+//*******************************************************************
+#include "Cursors.h"
+
+//*******************************************************************
+//
+// Cursors
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Cursors::Cursors( ScreenGraphic            &screenIn,
+                  const Viewport           &viewIn,
+                  WORD                      samplePeriodIn,
+                  const Trace::Calibration &calIn,
+                  WORD                      readoutXIn,
+                  WORD                      readoutYIn,
+                  WORD                      timeColorIn,
+                  WORD                      voltColorIn,
+                  WORD                      backColorIn )
+
+: screen( screenIn ),
+  view  ( viewIn   )
+
+{
+  samplePeriod = samplePeriodIn;
+  cal          = calIn;
+  readoutX     = readoutXIn;
+  readoutY     = readoutYIn;
+  timeColor    = timeColorIn;
+  voltColor    = voltColorIn;
+  backColor    = backColorIn;
+  grabbed      = NONE;
+
+  // default: at 1/4 and 3/4 of the window
+  const Trace::Window &w = view.getWindow();
+
+  pos[T1] = w.x + w.width /4;
+  pos[T2] = w.x + w.width *3/4;
+  pos[V1] = w.y + w.height/4;
+  pos[V2] = w.y + w.height*3/4;
+}
+
+//-------------------------------------------------------------------
+void Cursors::set( BYTE id, WORD p )
+{
+  if( id >= NUM_OF_CURSORS )
+  {
+    return;
+  }
+
+  const Trace::Window &w = view.getWindow();
+
+  if( isTime( id ) )
+  {
+    // the last column of the window is the last sample
+    if( p < w.x               ) p = w.x;
+    if( p > w.x + w.width - 1 ) p = w.x + w.width - 1;
+  }
+  else
+  {
+    if( p < w.y            ) p = w.y;
+    if( p > w.y + w.height ) p = w.y + w.height;
+  }
+  pos[id] = p;
+}
+
+//-------------------------------------------------------------------
+bool Cursors::update( const Pointer::Data &data, Trace::Region &erased )
+{
+  if( data.flags & Pointer::Data::CTRL_DWN )
+  {
+    // grab the nearest line
+    WORD distMin = GRAB_DISTANCE + 1;
+
+    grabbed = NONE;
+    for( BYTE id = 0; id < NUM_OF_CURSORS; id++ )
+    {
+      int  d    = isTime( id ) ? data.posX - pos[id] : data.posY - pos[id];
+      WORD dist = ( d < 0 ) ? -d : d;
+
+      if( dist < distMin )
+      {
+        distMin = dist;
+        grabbed = id;
+      }
+    }
+    return( false );
+  }
+
+  if( data.flags & Pointer::Data::CTRL_UP )
+  {
+    grabbed = NONE;
+    return( false );
+  }
+
+  if( grabbed == NONE )
+  {
+    return( false );
+  }
+
+  WORD old = pos[grabbed];
+
+  set( grabbed, isTime( grabbed ) ? data.posX : data.posY );
+
+  if( pos[grabbed] == old )
+  {
+    return( false );
+  }
+
+  // erase the old line only, the caller repairs what was below
+  WORD moved   = pos[grabbed];
+  pos[grabbed] = old;
+  erased       = getLineRegion( grabbed );
+  drawLine( grabbed, backColor );
+  pos[grabbed] = moved;
+
+  return( true );
+}
+
+//-------------------------------------------------------------------
+void Cursors::draw( void )
+{
+  drawLine( V1, voltColor );
+  drawLine( V2, voltColor );
+  drawLine( T1, timeColor );
+  drawLine( T2, timeColor );
+}
+
+//-------------------------------------------------------------------
+void Cursors::drawReadout( const volatile WORD *sample, WORD numOfSamples )
+{
+  Trace::Scale scale( view.getWindow(), cal );
+
+  DWORD idx1 = view.toIndex( pos[T1] );
+  DWORD idx2 = view.toIndex( pos[T2] );
+  DWORD dt   = ( ( idx2 > idx1 ) ? idx2 - idx1 : idx1 - idx2 ) * samplePeriod; // us
+  int   dV   = scale.toMilliVolt( pos[V1] ) - scale.toMilliVolt( pos[V2] );
+
+  WORD y = readoutY;
+
+  // dt [ms] and 1/dt [Hz], both with one decimal
+  if( dt > 0 )
+  {
+    DWORD f10 = 10000000UL / dt; // 1/dt [0.1 Hz]
+    screen.drawText( readoutX, y, "dt=%d.%dms 1/dt=%d.%dHz   ",
+                     (int)(dt / 1000), (int)((dt / 100) % 10),
+                     (int)(f10 / 10),  (int)(f10 % 10) );
+  }
+  else
+  {
+    screen.drawText( readoutX, y, "dt=0.0ms 1/dt=---            " );
+  }
+  y += LINE_HEIGHT;
+
+  screen.drawText( readoutX, y, "dV=%s%d.%03dV        ",
+                   ( dV < 0 ) ? "-" : "",
+                   ( dV < 0 ? -dV : dV ) / 1000,
+                   ( dV < 0 ? -dV : dV ) % 1000 );
+  y += LINE_HEIGHT;
+
+  // capture at the time cursors, from the raw samples
+  if( idx1 < numOfSamples && idx2 < numOfSamples )
+  {
+    int v1 = cal.toMilliVolt( sample[idx1] );
+    int v2 = cal.toMilliVolt( sample[idx2] );
+
+    screen.drawText( readoutX, y, "V(t1)=%dmV V(t2)=%dmV   ", v1, v2 );
+  }
+  else
+  {
+    // no sample, the old values must not stay on screen
+    screen.drawText( readoutX, y, "V(t1)=--- V(t2)=---          " );
+  }
+}
+
+//-------------------------------------------------------------------
+void Cursors::drawLine( BYTE id, WORD color )
+{
+  Trace::Region r = getLineRegion( id );
+
+  screen.drawLine( r.x0, r.y0, r.x1, r.y1, 1, color );
+}
+
+//-------------------------------------------------------------------
+Trace::Region Cursors::getLineRegion( BYTE id ) const
+{
+  const Trace::Window &w = view.getWindow();
+  Trace::Region        r;
+
+  if( isTime( id ) )
+  {
+    r.x0 = r.x1 = pos[id];
+    r.y0 = w.y;
+    r.y1 = w.y + w.height;
+  }
+  else
+  {
+    r.y0 = r.y1 = pos[id];
+    r.x0 = w.x;
+    r.x1 = w.x + w.width;
+  }
+  return( r );
+}
+
+//EOF
@@ -0,0 +1,152 @@
+//*******************************************************************
+/*!
+\file   Cursors.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Touch draggable time and voltage cursors with readout
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_CURSORS_H
+#define _SCOPE_CURSORS_H
+
+//*******************************************************************
+#include "Trace.h"
+#include "Viewport.h"
+
+//*******************************************************************
+/*!
+\class Cursors
+
+\brief Two vertical (time) and two horizontal (voltage) cursors
+
+A cursor is grabbed by touching the panel near its line and follows
+the finger until release. On every move only the old line is erased.
+The caller repairs the erased region, then the lines and the readout
+are drawn again:
+\code
+  Trace::Region erased;
+
+  if( cursors.update( pointer.get(), erased ) )
+  {
+    view.redraw( erased, cal, color ); // and the grid, if any
+    cursors.draw();
+    cursors.drawReadout( sample, numOfSamples );
+  }
+\endcode
+The readout shows dt, 1/dt and dV of the cursors as well as the
+voltage of the capture at both time cursors, taken from the raw
+samples.
+*/
+class Cursors
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      T1 = 0,  //!< Time cursor 1
+      T2,      //!< Time cursor 2
+      V1,      //!< Voltage cursor 1
+      V2,      //!< Voltage cursor 2
+      NUM_OF_CURSORS,
+      NONE = 0xFF
+    };
+
+    //---------------------------------------------------------------
+    enum
+    {
+      GRAB_DISTANCE = 24, //!< Max. distance of a touch to a line [px]
+      LINE_HEIGHT   = 20  //!< Readout line height [px], fits Font_10x20
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate the cursors
+        \param screen       Target screen
+        \param view         Viewport, the cursors belong to
+        \param samplePeriod Sample period of the capture [us]
+        \param cal          Calibration of the capture
+        \param readoutX     Left border of the readout [px]
+        \param readoutY     Top border of the readout [px]
+        \param timeColor    Color of the time cursors
+        \param voltColor    Color of the voltage cursors
+        \param backColor    Background color, used to erase a line
+    */
+    Cursors( ScreenGraphic            &screen,
+             const Viewport           &view,
+             WORD                      samplePeriod,
+             const Trace::Calibration &cal,
+             WORD                      readoutX,
+             WORD                      readoutY,
+             WORD                      timeColor,
+             WORD                      voltColor,
+             WORD                      backColor );
+
+    //---------------------------------------------------------------
+    /*! Set the position of a cursor
+        \param id  Cursor
+        \param pos x coordinate (time cursor) or y coordinate
+                   (voltage cursor), clipped to the viewport
+    */
+    void set( BYTE id, WORD pos );
+
+    //---------------------------------------------------------------
+    /*! Get the position of a cursor
+    */
+    WORD get( BYTE id ) const
+    {
+      return( ( id < NUM_OF_CURSORS ) ? pos[id] : 0 );
+    }
+
+    //---------------------------------------------------------------
+    /*! Process a pointer event
+        \param data   Pointer data
+        \param erased Region of the erased line, if a cursor moved
+        \return true, if a cursor moved
+    */
+    bool update( const Pointer::Data &data, Trace::Region &erased );
+
+    //---------------------------------------------------------------
+    /*! Draw all cursor lines
+    */
+    void draw( void );
+
+    //---------------------------------------------------------------
+    /*! Draw the readout. Old text is overwritten.
+        \param sample       Raw samples of the capture shown in the view
+        \param numOfSamples Number of samples
+    */
+    void drawReadout( const volatile WORD *sample, WORD numOfSamples );
+
+  private:
+    //---------------------------------------------------------------
+    void drawLine( BYTE id, WORD color );
+
+    //---------------------------------------------------------------
+    Trace::Region getLineRegion( BYTE id ) const;
+
+    //---------------------------------------------------------------
+    static bool isTime( BYTE id )
+    {
+      return( id == T1 || id == T2 );
+    }
+
+  private:
+    //---------------------------------------------------------------
+    ScreenGraphic            &screen;
+    const Viewport           &view;
+    WORD                      samplePeriod;
+    Trace::Calibration        cal;
+
+    WORD                      readoutX;
+    WORD                      readoutY;
+    WORD                      timeColor;
+    WORD                      voltColor;
+    WORD                      backColor;
+
+    WORD                      pos[NUM_OF_CURSORS];
+    BYTE                      grabbed;
+
+}; //Cursors
+
+#endif
@@ -0,0 +1,386 @@
+//*******************************************************************
+/*!
+\file   Decoder.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  UART, I2C and SPI decoder of captured traces
+*/
+
+//*******************************************************************
+#include "Decoder.h"
+
+//*******************************************************************
+//
+// Decoder
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Decoder::Decoder( const Trace::Calibration &calIn,
+                  WORD                      samplePeriodIn,
+                  WORD                      maxEventsIn )
+{
+  cal          = calIn;
+  samplePeriod = samplePeriodIn;
+  maxEvents    = maxEventsIn;
+  event        = new Event[ maxEvents ];
+  numOfEvents  = 0;
+  protocol     = NONE;
+  wordGap      = 8;
+
+  setThreshold( 1650 );
+  setBaudrate( 1200 );
+}
+
+//-------------------------------------------------------------------
+void Decoder::setProtocol( BYTE protocolIn )
+{
+  protocol    = ( protocolIn < NUM_OF_PROTOCOLS ) ? protocolIn : (BYTE)NONE;
+  numOfEvents = 0;
+}
+
+//-------------------------------------------------------------------
+void Decoder::setThreshold( int mV )
+{
+  int code = ( cal.fullScale > 0 ) ? ( mV - cal.offset ) * 0x10000 / cal.fullScale : 0;
+
+  threshold = ( code < 0 ) ? 0 : ( code > 0xFFFF ) ? 0xFFFF : code;
+}
+
+//-------------------------------------------------------------------
+void Decoder::setBaudrate( DWORD baud )
+{
+  // samples per bit = 1/(baud * samplePeriod)
+  bitPeriod = ( baud > 0 ) ? (DWORD)( 256000000ULL / ( (unsigned long long)baud * samplePeriod ) ) : 0;
+}
+
+//-------------------------------------------------------------------
+void Decoder::setWordGap( WORD samples )
+{
+  wordGap = samples;
+}
+
+//-------------------------------------------------------------------
+WORD Decoder::decode( const volatile WORD *a,
+                      const volatile WORD *b,
+                      WORD                 numOfSamples )
+{
+  numOfEvents = 0;
+
+  switch( protocol )
+  {
+    case UART: decodeUart( a,    numOfSamples ); break;
+    case I2C:  decodeI2c ( a, b, numOfSamples ); break;
+    case SPI:  decodeSpi ( a, b, numOfSamples ); break;
+  }
+  return( numOfEvents );
+}
+
+//-------------------------------------------------------------------
+WORD Decoder::find( DWORD sample ) const
+{
+  // the events are sorted by start and do not overlap, so also by end
+  WORD lo = 0;
+  WORD hi = numOfEvents;
+
+  while( lo < hi )
+  {
+    WORD mid = ( lo + hi ) / 2;
+
+    if( event[mid].end < sample )
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return( lo );
+}
+
+//-------------------------------------------------------------------
+void Decoder::drawAnnotations( ScreenGraphic  &screen,
+                               const Viewport &view,
+                               WORD            y,
+                               WORD            color ) const
+{
+  DWORD last = view.getFirst() + view.getNumOfSamples();
+
+  for( WORD i = find( view.getFirst() ); i < numOfEvents && event[i].start < last; i++ )
+  {
+    const Event &e = event[i];
+
+    WORD x0 = view.toX( e.start );
+    WORD x1 = view.toX( e.end );
+
+    // bracket over the duration of the item
+    screen.drawLine( x0, y, x1, y,     1, color );
+    screen.drawLine( x0, y, x0, y + 4, 1, color );
+    screen.drawLine( x1, y, x1, y + 4, 1, color );
+
+    // text only, if it fits between the brackets
+    WORD width = x1 - x0;
+    BYTE type  = e.type & Event::TYPE;
+
+    if( type == Event::START && width >= 10 )
+    {
+      screen.drawText( x0 + 1, y + 2, "S" );
+    }
+    else if( type == Event::STOP && width >= 10 )
+    {
+      screen.drawText( x0 + 1, y + 2, "P" );
+    }
+    else if( width >= 40 )
+    {
+      screen.drawText( x0 + 2, y + 2, "%s%02X%s",
+                       ( type == Event::ADDRESS ) ? "@" : "",
+                       e.value,
+                       ( e.type & Event::ERROR  ) ? "!"
+                     : ( e.type & Event::NACK   ) ? "~" : "" );
+    }
+  }
+}
+
+//-------------------------------------------------------------------
+void Decoder::drawTable( ScreenGraphic &screen,
+                         WORD           x,
+                         WORD           y,
+                         WORD           first,
+                         WORD           numOfLines ) const
+{
+  static const char *typeName[] =
+  {
+    "     ", "start", "stop ", "addr ", "data "
+  };
+
+  for( WORD line = 0; line < numOfLines; line++, y += LINE_HEIGHT )
+  {
+    WORD i = first + line;
+
+    if( i >= numOfEvents )
+    {
+      screen.drawText( x, y, "                                  " );
+      continue;
+    }
+
+    const Event &e    = event[i];
+    BYTE         type = e.type & Event::TYPE;
+    DWORD        t    = (DWORD)e.start * samplePeriod; // us
+
+    if( type == Event::START || type == Event::STOP )
+    {
+      screen.drawText( x, y, "%3d %5d.%dms %s              ",
+                       i, (int)(t / 1000), (int)((t / 100) % 10), typeName[type] );
+    }
+    else
+    {
+      char c = ( e.value >= 0x20 && e.value < 0x7F ) ? e.value : '.';
+
+      screen.drawText( x, y, "%3d %5d.%dms %s 0x%02X '%c' %s  ",
+                       i, (int)(t / 1000), (int)((t / 100) % 10), typeName[type],
+                       e.value, c,
+                       ( e.type & Event::ERROR ) ? "frame"
+                     : ( e.type & Event::NACK  ) ? "nack " : "     " );
+    }
+  }
+}
+
+//-------------------------------------------------------------------
+const char *Decoder::getName( BYTE p )
+{
+  static const char *name[NUM_OF_PROTOCOLS] =
+  {
+    "off", "UART", "I2C", "SPI"
+  };
+  return( ( p < NUM_OF_PROTOCOLS ) ? name[p] : "" );
+}
+
+//-------------------------------------------------------------------
+void Decoder::decodeUart( const volatile WORD *a, WORD n )
+{
+  enum { IDLE, START_BIT, DATA_BITS, STOP_BIT, BREAK };
+
+  if( bitPeriod < 3 * 256 )
+  {
+    return; // less than 3 samples per bit
+  }
+
+  BYTE  state = IDLE;
+  WORD  start = 0;
+  DWORD next  = 0;  // time of the next bit center [1/256 sample]
+  BYTE  bit   = 0;
+  BYTE  value = 0;
+  bool  prev  = ( n > 0 ) ? ( a[0] >= threshold ) : true;
+
+  // a capture starting within a character has no edge at sample 0
+  for( WORD i = 1; i < n; i++ )
+  {
+    bool  level = ( a[i] >= threshold );
+    DWORD t     = (DWORD)i * 256;
+
+    switch( state )
+    {
+      case IDLE:
+        if( prev && !level )
+        {
+          // falling edge between i-1 and i, first bit center 1/2 bit later
+          start = i;
+          next  = t - 128 + bitPeriod / 2;
+          state = START_BIT;
+        }
+        break;
+
+      case START_BIT:
+        if( t >= next )
+        {
+          // a glitch is no start bit
+          state = level ? (BYTE)IDLE : (BYTE)DATA_BITS;
+          next += bitPeriod;
+          bit   = 0;
+          value = 0;
+        }
+        break;
+
+      case DATA_BITS:
+        if( t >= next )
+        {
+          value |= ( level ? 1 : 0 ) << bit;
+          next  += bitPeriod;
+          if( ++bit == 8 )
+          {
+            state = STOP_BIT;
+          }
+        }
+        break;
+
+      case STOP_BIT:
+        if( t >= next )
+        {
+          add( start, i, Event::DATA | ( level ? 0 : Event::ERROR ), value );
+          state = level ? (BYTE)IDLE : (BYTE)BREAK;
+        }
+        break;
+
+      case BREAK: // framing error, wait for the idle level
+        if( level )
+        {
+          state = IDLE;
+        }
+        break;
+    }
+    prev = level;
+  }
+}
+
+//-------------------------------------------------------------------
+void Decoder::decodeI2c( const volatile WORD *a, const volatile WORD *b, WORD n )
+{
+  bool prevScl   = ( n > 0 ) ? ( a[0] >= threshold ) : true;
+  bool prevSda   = ( n > 0 ) ? ( b[0] >= threshold ) : true;
+  bool isFrame   = false;
+  bool isAddress = false;
+  BYTE bit       = 0;
+  BYTE value     = 0;
+  WORD start     = 0;
+
+  // the levels at sample 0 are no condition, only a change after it
+  for( WORD i = 1; i < n; i++ )
+  {
+    bool scl = ( a[i] >= threshold );
+    bool sda = ( b[i] >= threshold );
+
+    if( scl && prevScl && sda != prevSda )
+    {
+      // SDA changes while SCL is high: start or stop condition
+      if( !sda )
+      {
+        add( i, i, Event::START, 0 );
+        isFrame   = true;
+        isAddress = true;
+        bit       = 0;
+        value     = 0;
+      }
+      else
+      {
+        add( i, i, Event::STOP, 0 );
+        isFrame = false;
+      }
+    }
+    else if( scl && !prevScl && isFrame )
+    {
+      // rising SCL: data bit 0 ... 7, then acknowledge
+      if( bit < 8 )
+      {
+        if( bit == 0 )
+        {
+          start = i;
+        }
+        value = ( value << 1 ) | ( sda ? 1 : 0 );
+        bit++;
+      }
+      else
+      {
+        add( start, i, ( isAddress ? Event::ADDRESS : Event::DATA ) | ( sda ? Event::NACK : 0 ), value );
+        isAddress = false;
+        bit       = 0;
+        value     = 0;
+      }
+    }
+    prevScl = scl;
+    prevSda = sda;
+  }
+}
+
+//-------------------------------------------------------------------
+void Decoder::decodeSpi( const volatile WORD *a, const volatile WORD *b, WORD n )
+{
+  bool prevSck  = ( n > 0 ) ? ( a[0] >= threshold ) : false;
+  BYTE bit      = 0;
+  BYTE value    = 0;
+  WORD start    = 0;
+  WORD lastEdge = 0;
+
+  for( WORD i = 1; i < n; i++ )
+  {
+    bool sck = ( a[i] >= threshold );
+
+    if( sck && !prevSck )
+    {
+      // a clock pause starts a new word
+      if( bit > 0 && i - lastEdge > wordGap )
+      {
+        bit = 0;
+      }
+      if( bit == 0 )
+      {
+        start = i;
+        value = 0;
+      }
+      value = ( value << 1 ) | ( ( b[i] >= threshold ) ? 1 : 0 );
+      lastEdge = i;
+
+      if( ++bit == 8 )
+      {
+        add( start, i, Event::DATA, value );
+        bit = 0;
+      }
+    }
+    prevSck = sck;
+  }
+}
+
+//-------------------------------------------------------------------
+void Decoder::add( WORD start, WORD end, BYTE type, BYTE value )
+{
+  if( numOfEvents < maxEvents )
+  {
+    Event &e = event[numOfEvents++];
+
+    e.start = start;
+    e.end   = end;
+    e.type  = type;
+    e.value = value;
+  }
+}
+
+//EOF
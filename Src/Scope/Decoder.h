@@ -0,0 +1,201 @@
+//*******************************************************************
+/*!
+\file   Decoder.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  UART, I2C and SPI decoder of captured traces
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_DECODER_H
+#define _SCOPE_DECODER_H
+
+//*******************************************************************
+#include "Trace.h"
+#include "Viewport.h"
+
+//*******************************************************************
+/*!
+\class Decoder
+
+\brief Decodes a serial bus from one or two channels into events
+
+Both channels are compared with one threshold. The capture is scanned
+once per decode() and the result is stored as a list of events sorted
+by time. Drawing a zoomed or panned section only searches this list,
+nothing is decoded again.
+
+Channel use:
+- UART: A = RX/TX line, 8N1, LSB first
+- I2C:  A = SCL, B = SDA
+- SPI:  A = SCK, B = MOSI, mode 0, MSB first, 8 bit words. Without a
+        chip select a word starts after a clock pause of more than
+        setWordGap() samples.
+
+A bit needs at least 3 samples, so the bit rate is limited to a third
+of the sample rate.
+*/
+class Decoder
+{
+  public:
+    //---------------------------------------------------------------
+    enum Protocol
+    {
+      NONE = 0,
+      UART,
+      I2C,
+      SPI,
+      NUM_OF_PROTOCOLS
+    };
+
+    //---------------------------------------------------------------
+    /*! Decoded item, sample indices of its start and end
+    */
+    class Event
+    {
+      public:
+        enum
+        {
+          START = 1, //!< I2C start condition
+          STOP,      //!< I2C stop condition
+          ADDRESS,   //!< I2C address byte, including R/W
+          DATA,      //!< Data byte
+
+          TYPE  = 0x0F,
+          NACK  = 0x40, //!< Flag: not acknowledged (I2C)
+          ERROR = 0x80  //!< Flag: framing error (UART)
+        };
+
+        WORD start;
+        WORD end;
+        BYTE type;  //!< Type and flags
+        BYTE value;
+    };
+
+    //---------------------------------------------------------------
+    enum
+    {
+      LINE_HEIGHT = 20 //!< Table line height [px], fits Font_10x20
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a decoder
+        \param cal          Calibration of the channels
+        \param samplePeriod Sample period [us]
+        \param maxEvents    Size of the event list
+    */
+    Decoder( const Trace::Calibration &cal,
+             WORD                      samplePeriod,
+             WORD                      maxEvents );
+
+    //---------------------------------------------------------------
+    /*! Select the protocol, NONE clears the events
+    */
+    void setProtocol( BYTE protocol );
+
+    //---------------------------------------------------------------
+    BYTE getProtocol( void ) const
+    {
+      return( protocol );
+    }
+
+    //---------------------------------------------------------------
+    /*! Set the logic threshold [mV]
+    */
+    void setThreshold( int mV );
+
+    //---------------------------------------------------------------
+    /*! Set the UART bit rate [baud]
+    */
+    void setBaudrate( DWORD baud );
+
+    //---------------------------------------------------------------
+    /*! Set the SPI clock pause separating words [samples]
+    */
+    void setWordGap( WORD samples );
+
+    //---------------------------------------------------------------
+    /*! Decode a capture
+        \param a            Raw samples of channel A
+        \param b            Raw samples of channel B
+        \param numOfSamples Number of samples
+        \return Number of events
+    */
+    WORD decode( const volatile WORD *a,
+                 const volatile WORD *b,
+                 WORD                 numOfSamples );
+
+    //---------------------------------------------------------------
+    WORD getNumOfEvents( void ) const
+    {
+      return( numOfEvents );
+    }
+
+    //---------------------------------------------------------------
+    const Event &getEvent( WORD idx ) const
+    {
+      return( event[idx] );
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the first event ending at or after a sample (binary search)
+        \return Index of the event, getNumOfEvents() if there is none
+    */
+    WORD find( DWORD sample ) const;
+
+    //---------------------------------------------------------------
+    /*! Draw the events within the sample range of a viewport
+        \param screen Target screen
+        \param view   Viewport
+        \param y      Top of the annotation row
+        \param color  Color
+    */
+    void drawAnnotations( ScreenGraphic  &screen,
+                          const Viewport &view,
+                          WORD            y,
+                          WORD            color ) const;
+
+    //---------------------------------------------------------------
+    /*! Draw a table of events
+        \param screen     Target screen
+        \param x,y        Upper left corner
+        \param first      Index of the first event
+        \param numOfLines Number of lines
+    */
+    void drawTable( ScreenGraphic &screen,
+                    WORD           x,
+                    WORD           y,
+                    WORD           first,
+                    WORD           numOfLines ) const;
+
+    //---------------------------------------------------------------
+    /*! Get the name of a protocol
+    */
+    static const char *getName( BYTE protocol );
+
+  private:
+    //---------------------------------------------------------------
+    void decodeUart( const volatile WORD *a, WORD n );
+    void decodeI2c ( const volatile WORD *a, const volatile WORD *b, WORD n );
+    void decodeSpi ( const volatile WORD *a, const volatile WORD *b, WORD n );
+
+    //---------------------------------------------------------------
+    void add( WORD start, WORD end, BYTE type, BYTE value );
+
+  private:
+    //---------------------------------------------------------------
+    Trace::Calibration cal;
+    WORD               samplePeriod;
+    BYTE               protocol;
+    WORD               threshold;   // [code]
+    DWORD              bitPeriod;   // UART [1/256 sample]
+    WORD               wordGap;     // SPI [samples]
+
+    Event             *event;
+    WORD               maxEvents;
+    WORD               numOfEvents;
+
+}; //Decoder
+
+#endif
@@ -0,0 +1,164 @@
+//*******************************************************************
+/*!
+\file   Dsp.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Fixed point helpers with Cortex-M7 DSP instructions
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_DSP_H
+#define _SCOPE_DSP_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+
+#if defined( __ARM_FEATURE_DSP )
+  #include <arm_acle.h>
+#endif
+
+//*******************************************************************
+/*!
+\class Dsp
+
+\brief Q15 arithmetic and logarithm
+
+On targets with the ARM DSP extension (Cortex-M4/M7) the dual 16 bit
+multiply instructions (SMUAD, SMUSD, SMLAD, ...) are used. Otherwise a
+portable implementation with the same results is compiled, e.g. for
+the Virtual board or a host build.
+
+Two Q15 values are packed into one 32 bit word as (lo | hi << 16).
+*/
+class Dsp
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Saturate to 16 bit
+    */
+    static inline short sat16( int x )
+    {
+      #if defined( __ARM_FEATURE_SAT )
+        return( __ssat( x, 16 ) );
+      #else
+        return( ( x > 32767 ) ? 32767 : ( x < -32768 ) ? -32768 : x );
+      #endif
+    }
+
+    //---------------------------------------------------------------
+    /*! Q15 multiplication
+    */
+    static inline short mul( short a, short b )
+    {
+      return( ((int)a * b) >> 15 );
+    }
+
+    //---------------------------------------------------------------
+    /*! Pack two 16 bit values into one word
+    */
+    static inline DWORD pack( short lo, short hi )
+    {
+      return( (WORD)lo | ((DWORD)(WORD)hi << 16) );
+    }
+
+    //---------------------------------------------------------------
+    /*! Dual saturating addition: (x.lo+y.lo, x.hi+y.hi)
+    */
+    static inline DWORD add2( DWORD x, DWORD y )
+    {
+      #if defined( __ARM_FEATURE_DSP )
+        return( __qadd16( x, y ) );
+      #else
+        return( pack( sat16( (short)x         + (short)y         ),
+                      sat16( (short)(x >> 16) + (short)(y >> 16) ) ) );
+      #endif
+    }
+
+    //---------------------------------------------------------------
+    /*! Dual saturating subtraction: (x.lo-y.lo, x.hi-y.hi)
+    */
+    static inline DWORD sub2( DWORD x, DWORD y )
+    {
+      #if defined( __ARM_FEATURE_DSP )
+        return( __qsub16( x, y ) );
+      #else
+        return( pack( sat16( (short)x         - (short)y         ),
+                      sat16( (short)(x >> 16) - (short)(y >> 16) ) ) );
+      #endif
+    }
+
+    //---------------------------------------------------------------
+    /*! Dual multiply accumulate: acc + x.lo*y.lo + x.hi*y.hi
+    */
+    static inline int mac2( int acc, DWORD x, DWORD y )
+    {
+      #if defined( __ARM_FEATURE_DSP )
+        return( __smlad( x, y, acc ) );
+      #else
+        return( acc + (int)(short)x         * (short)y
+                    + (int)(short)(x >> 16) * (short)(y >> 16) );
+      #endif
+    }
+
+    //---------------------------------------------------------------
+    /*! Complex Q15 multiplication (xr + j*xi) * (wr + j*wi)
+        \param x  Packed (xr,xi)
+        \param w  Packed (wr,wi)
+        \param re Real part, Q15
+        \param im Imaginary part, Q15
+    */
+    static inline void cmul( DWORD x, DWORD w, short &re, short &im )
+    {
+      #if defined( __ARM_FEATURE_DSP )
+        re = __smusd ( x, w ) >> 15; // xr*wr - xi*wi
+        im = __smuadx( x, w ) >> 15; // xr*wi + xi*wr
+      #else
+        int xr = (short)x, xi = (short)(x >> 16);
+        int wr = (short)w, wi = (short)(w >> 16);
+
+        re = ( xr*wr - xi*wi ) >> 15;
+        im = ( xr*wi + xi*wr ) >> 15;
+      #endif
+    }
+
+    //---------------------------------------------------------------
+    /*! Base 2 logarithm, 8 fractional bits (log2(x) * 256)
+        \return log2 or 0, if x is 0
+    */
+    static inline int log2Q8( DWORD x )
+    {
+      // log2(1 + i/32) * 256
+      static const WORD table[33] =
+      {
+          0,  11,  22,  33,  44,  54,  63,  73,  82,  92, 100, 109,
+        118, 126, 134, 142, 150, 157, 165, 172, 179, 186, 193, 200,
+        207, 213, 220, 226, 232, 238, 244, 250, 256
+      };
+
+      if( x == 0 )
+      {
+        return( 0 );
+      }
+
+      int   n = 31 - __builtin_clz( x );
+      DWORD m = x << ( 31 - n );           // leading one at bit 31
+      int   i = ( m >> 26 ) & 0x1F;        // next 5 bits: table index
+      int   f = ( m >> 18 ) & 0xFF;        // next 8 bits: interpolation
+
+      int frac = table[i] + ( ( (table[i + 1] - table[i]) * f ) >> 8 );
+
+      return( n * 256 + frac );
+    }
+
+    //---------------------------------------------------------------
+    /*! Power ratio in 0.1 dB: 100*log10(x)
+    */
+    static inline int deciBel( DWORD x )
+    {
+      // 100*log10(2)/256 = 0.11759, scaled by 2^16
+      return( ( log2Q8( x ) * 7706 ) >> 16 );
+    }
+
+}; //Dsp
+
+#endif
@@ -0,0 +1,222 @@
+//*******************************************************************
+/*!
+\file   Fft.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Fixed point FFT with window functions
+*/
+
+//*******************************************************************
+#include <math.h>
+
+#include "Fft.h"
+
+//*******************************************************************
+//
+// Fft
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Fft::Fft( WORD sizeIn )
+{
+  log2Size = 4;
+  while( log2Size < 13 && (2U << log2Size) <= sizeIn )
+  {
+    log2Size++;
+  }
+  size = 1U << log2Size;
+
+  re      = new short[ size ];
+  im      = new short[ size ];
+  twiddle = new DWORD[ size/2 ];
+  coeff   = new short[ size ];
+
+  // computed once, so float is acceptable here
+  for( WORD k = 0; k < size/2; k++ )
+  {
+    float phi = 2.0f * (float)M_PI * k / size;
+
+    twiddle[k] = Dsp::pack( Dsp::sat16( (int)lroundf(  cosf( phi ) * 32768.0f ) ),
+                            Dsp::sat16( (int)lroundf( -sinf( phi ) * 32768.0f ) ) );
+  }
+
+  for( WORD k = 0; k < size; k++ )
+  {
+    re[k] = im[k] = 0;
+  }
+  shift = log2Size;
+
+  setWindow( HANN );
+}
+
+//-------------------------------------------------------------------
+void Fft::setWindow( BYTE windowIn )
+{
+  // coherent gain of the windows: 1, 0.5, 0.42, 0.2156
+  static const int gainTable[NUM_OF_WINDOWS] = { 0, 60, 75, 133 };
+
+  window = ( windowIn < NUM_OF_WINDOWS ) ? windowIn : (BYTE)RECTANGLE;
+  gain   = gainTable[window];
+
+  for( WORD k = 0; k < size; k++ )
+  {
+    float x = 2.0f * (float)M_PI * k / size;
+    float w = 1.0f;
+
+    switch( window )
+    {
+      case HANN:
+        w = 0.5f - 0.5f*cosf( x );
+        break;
+
+      case BLACKMAN:
+        w = 0.42f - 0.5f*cosf( x ) + 0.08f*cosf( 2*x );
+        break;
+
+      case FLATTOP:
+        w =   0.21557895f - 0.41663158f*cosf( x   ) + 0.277263158f*cosf( 2*x )
+            - 0.083578947f*cosf( 3*x ) + 0.006947368f*cosf( 4*x );
+        break;
+    }
+    coeff[k] = Dsp::sat16( (int)lroundf( w * 32768.0f ) );
+  }
+}
+
+//-------------------------------------------------------------------
+const char *Fft::getWindowName( BYTE w )
+{
+  static const char *name[NUM_OF_WINDOWS] =
+  {
+    "Rectangle", "Hann", "Blackman", "Flat top"
+  };
+  return( ( w < NUM_OF_WINDOWS ) ? name[w] : "" );
+}
+
+//-------------------------------------------------------------------
+void Fft::transform( const volatile WORD *sample, WORD numOfSamples )
+{
+  WORD n = ( numOfSamples < size ) ? numOfSamples : size;
+
+  if( n == 0 )
+  {
+    return;
+  }
+
+  // mean, so the DC bin does not leak into the spectrum
+  DWORD sum = 0;
+  for( WORD i = 0; i < n; i++ )
+  {
+    sum += sample[i];
+  }
+  int mean = sum / n;
+
+  // Q15 input: (code - mean)/2 fits into 16 bit, stored bit reversed
+  for( WORD i = 0; i < size; i++ )
+  {
+    short x = 0;
+    if( i < n )
+    {
+      x = Dsp::mul( ( (int)sample[i] - mean ) >> 1, coeff[i] );
+    }
+    WORD r = reverse( i );
+    re[r] = x;
+    im[r] = 0;
+  }
+
+  // radix-2 decimation in time. A stage is scaled by 1/2 only if it
+  // could overflow (block floating point), so small signals keep
+  // their resolution
+  shift = 0;
+  for( BYTE stage = 0; stage < log2Size; stage++ )
+  {
+    WORD half  = 1U << stage;
+    WORD step  = size >> ( stage + 1 ); // twiddle index step
+    BYTE scale = needsScaling() ? 1 : 0;
+
+    shift += scale;
+
+    for( WORD k = 0; k < half; k++ )
+    {
+      DWORD w = twiddle[k * step];
+
+      for( WORD i = k; i < size; i += 2*half )
+      {
+        WORD  j = i + half;
+        short tr;
+        short ti;
+
+        Dsp::cmul( Dsp::pack( re[j], im[j] ), w, tr, ti );
+
+        int ar = re[i] >> scale;
+        int ai = im[i] >> scale;
+
+        tr >>= scale;
+        ti >>= scale;
+
+        re[i] = ar + tr;
+        im[i] = ai + ti;
+        re[j] = ar - tr;
+        im[j] = ai - ti;
+      }
+    }
+  }
+}
+
+//-------------------------------------------------------------------
+bool Fft::needsScaling( void ) const
+{
+  // |a| + |w*b| <= 32767 holds for components up to 8191
+  for( WORD i = 0; i < size; i++ )
+  {
+    if(    re[i] > 8191 || re[i] < -8191
+        || im[i] > 8191 || im[i] < -8191 )
+    {
+      return( true );
+    }
+  }
+  return( false );
+}
+
+//-------------------------------------------------------------------
+DWORD Fft::getPower( WORD k ) const
+{
+  if( k > size/2 )
+  {
+    return( 0 );
+  }
+  return( (DWORD)( (int)re[k]*re[k] ) + (DWORD)( (int)im[k]*im[k] ) );
+}
+
+//-------------------------------------------------------------------
+int Fft::getDeciBel( WORD k ) const
+{
+  // a full scale sine (amplitude 16384 after the input conversion)
+  // gives |X[k]| = 8192 times the window gain, if every stage is
+  // scaled, i.e. a power of 2^26
+  const int fullScale = ( 26 * 30103 + 500 ) / 1000; // 10*log10(2^26) [0.1 dB]
+
+  DWORD p = getPower( k );
+
+  if( p == 0 )
+  {
+    return( -1500 );
+  }
+
+  // each stage not scaled made the power 4 times (6.02 dB) higher
+  return( Dsp::deciBel( p ) - fullScale + gain - 60 * ( log2Size - shift ) );
+}
+
+//-------------------------------------------------------------------
+WORD Fft::reverse( WORD i ) const
+{
+  WORD r = 0;
+
+  for( BYTE b = 0; b < log2Size; b++ )
+  {
+    r = ( r << 1 ) | ( i & 1 );
+    i >>= 1;
+  }
+  return( r );
+}
+
+//EOF
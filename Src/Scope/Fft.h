@@ -0,0 +1,126 @@
+//*******************************************************************
+/*!
+\file   Fft.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Fixed point FFT with window functions
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_FFT_H
+#define _SCOPE_FFT_H
+
+//*******************************************************************
+#include "Dsp.h"
+
+//*******************************************************************
+/*!
+\class Fft
+
+\brief Radix-2 FFT of a capture in Q15 fixed point
+
+The samples are converted to Q15 after removing the mean, multiplied
+with the window and transformed in place. A butterfly stage is scaled
+by 1/2, if its input could overflow (block floating point). So large
+signals can not overflow and small signals keep their resolution. The
+complex multiplications use the dual 16 bit instructions of the
+Cortex-M7 (see Dsp).
+
+The magnitude is given in 0.1 dB relative to a full scale sine (the
+whole ADC range), corrected by the coherent gain of the window.
+*/
+class Fft
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Window functions
+    */
+    enum Window
+    {
+      RECTANGLE = 0,
+      HANN,
+      BLACKMAN,
+      FLATTOP,
+      NUM_OF_WINDOWS
+    };
+
+    //---------------------------------------------------------------
+    enum
+    {
+      MIN_SIZE = 16,
+      MAX_SIZE = 8192
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a transform
+        \param size Number of points, power of 2 from MIN_SIZE to
+                    MAX_SIZE (rounded down, if not)
+    */
+    Fft( WORD size );
+
+    //---------------------------------------------------------------
+    /*! Select the window function
+    */
+    void setWindow( BYTE window );
+
+    //---------------------------------------------------------------
+    BYTE getWindow( void ) const
+    {
+      return( window );
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the name of a window function
+    */
+    static const char *getWindowName( BYTE window );
+
+    //---------------------------------------------------------------
+    WORD getSize( void ) const
+    {
+      return( size );
+    }
+
+    //---------------------------------------------------------------
+    /*! Transform raw samples. Missing samples are zero padded,
+        samples beyond the size are ignored.
+        \param sample       Raw samples
+        \param numOfSamples Number of samples
+    */
+    void transform( const volatile WORD *sample, WORD numOfSamples );
+
+    //---------------------------------------------------------------
+    /*! Get the squared magnitude of a bin (Q30)
+        \param k Bin, 0 ... size/2
+    */
+    DWORD getPower( WORD k ) const;
+
+    //---------------------------------------------------------------
+    /*! Get the magnitude of a bin [0.1 dBFS]
+        \param k Bin, 0 ... size/2
+    */
+    int getDeciBel( WORD k ) const;
+
+  private:
+    //---------------------------------------------------------------
+    WORD reverse( WORD i ) const;
+
+    //---------------------------------------------------------------
+    bool needsScaling( void ) const;
+
+  private:
+    //---------------------------------------------------------------
+    WORD   size;
+    BYTE   log2Size;
+    BYTE   window;
+    int    gain;      // coherent gain correction of the window [0.1 dB]
+    BYTE   shift;     // number of scaled stages of the last transform
+
+    short *re;
+    short *im;
+    DWORD *twiddle;   // packed (cos,-sin), size/2 entries
+    short *coeff;     // window, size entries
+
+}; //Fft
+
+#endif
@@ -0,0 +1,305 @@
+//*******************************************************************
+/*!
+\file   Filter.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Fixed point FIR, IIR and moving average filters
+*/
+
+//*******************************************************************
+#include <math.h>
+
+#include "Filter.h"
+
+//*******************************************************************
+//
+// Filter
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+void Filter::process( volatile WORD *sample, WORD numOfSamples )
+{
+  short x[ BLOCK_SIZE ];
+
+  for( WORD first = 0; first < numOfSamples; first += BLOCK_SIZE )
+  {
+    WORD n = numOfSamples - first;
+    if( n > BLOCK_SIZE )
+    {
+      n = BLOCK_SIZE;
+    }
+
+    for( WORD i = 0; i < n; i++ )
+    {
+      x[i] = toQ15( sample[first + i] );
+    }
+
+    processBlock( x, n );
+
+    for( WORD i = 0; i < n; i++ )
+    {
+      sample[first + i] = toCode( x[i] );
+    }
+  }
+}
+
+//*******************************************************************
+//
+// Fir
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Fir::Fir( BYTE numOfTapsIn, WORD cutoff )
+{
+  init( numOfTapsIn );
+
+  // windowed sinc (Hamming), computed once, so float is acceptable
+  BYTE  half = numOfTaps / 2;
+  float fc   = cutoff / 1000.0f;
+  float h[ MAX_TAPS/2 + 1 ];
+  float sum  = 0.0f;
+
+  for( BYTE k = 0; k <= half; k++ )
+  {
+    int   m = k - half;
+    float s = ( m == 0 ) ? 2.0f * fc
+                         : sinf( 2.0f * (float)M_PI * fc * m ) / ( (float)M_PI * m );
+    float w = 0.54f - 0.46f * cosf( 2.0f * (float)M_PI * k / ( numOfTaps - 1 ) );
+
+    h[k] = s * w;
+    sum += ( k == half ) ? h[k] : 2.0f * h[k];
+  }
+
+  // DC gain 1
+  short q[ MAX_TAPS/2 + 1 ];
+  for( BYTE k = 0; k <= half; k++ )
+  {
+    q[k] = Dsp::sat16( (int)lroundf( h[k] / sum * 32767.0f ) );
+  }
+
+  setCoeff( q );
+}
+
+//-------------------------------------------------------------------
+Fir::Fir( const short *coeffIn, BYTE numOfTapsIn )
+{
+  init( numOfTapsIn );
+  setCoeff( coeffIn );
+}
+
+//-------------------------------------------------------------------
+void Fir::setCoeff( const short *coeffIn )
+{
+  // taps 0 ... half-1 are paired, the center tap is separate
+  BYTE half = numOfTaps / 2;
+
+  for( BYTE k = 0; k < half; k += 2 )
+  {
+    coeff[k/2] = Dsp::pack( coeffIn[k], ( k + 1 < half ) ? coeffIn[k + 1] : 0 );
+  }
+  center = coeffIn[half];
+}
+
+//-------------------------------------------------------------------
+void Fir::init( BYTE numOfTapsIn )
+{
+  if( numOfTapsIn > MAX_TAPS )
+  {
+    numOfTapsIn = MAX_TAPS;
+  }
+  numOfTaps = numOfTapsIn | 1; // odd
+
+  for( BYTE k = 0; k < MAX_TAPS/4 + 1; k++ )
+  {
+    coeff[k] = 0;
+  }
+  center = 0x7FFF;
+
+  reset( 0x8000 );
+}
+
+//-------------------------------------------------------------------
+void Fir::reset( WORD code )
+{
+  for( WORD i = 0; i < numOfTaps - 1; i++ )
+  {
+    history[i] = toQ15( code ) >> 1;
+  }
+}
+
+//-------------------------------------------------------------------
+void Fir::processBlock( short *x, WORD n )
+{
+  // history: numOfTaps-1 samples of the last block, followed by this block
+  short *buf  = history + numOfTaps - 1;
+  BYTE   half = numOfTaps / 2;
+
+  for( WORD i = 0; i < n; i++ )
+  {
+    buf[i] = x[i] >> 1;
+  }
+
+  for( WORD i = 0; i < n; i++ )
+  {
+    const short *newest = buf + i;                 // x[n]
+    const short *oldest = buf + i - numOfTaps + 1; // x[n-N+1]
+    int          acc    = (int)center * newest[-half];
+
+    for( BYTE k = 0; k < half; k += 2 )
+    {
+      // x[n-k] + x[n-N+1+k] and x[n-k-1] + x[n-N+2+k], share tap k and k+1
+      short s0 = newest[-k] + oldest[k];
+      short s1 = ( k + 1 < half ) ? newest[-k-1] + oldest[k+1] : 0;
+
+      acc = Dsp::mac2( acc, Dsp::pack( s0, s1 ), coeff[k/2] );
+    }
+    x[i] = Dsp::sat16( acc >> 14 ); // input/2 in Q15, so >> (15-1)
+  }
+
+  // keep the last numOfTaps-1 inputs for the next block
+  for( WORD i = 0; i < numOfTaps - 1; i++ )
+  {
+    history[i] = history[i + n];
+  }
+}
+
+//*******************************************************************
+//
+// Biquad
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Biquad::Biquad( BYTE numOfSectionsIn, WORD cutoff )
+{
+  numOfSections = ( numOfSectionsIn > MAX_SECTIONS ) ? (BYTE)MAX_SECTIONS
+                : ( numOfSectionsIn < 1 )            ? 1
+                :                                      numOfSectionsIn;
+
+  // Butterworth of order 2*numOfSections: sections with different Q
+  float w0 = 2.0f * (float)M_PI * cutoff / 1000.0f;
+
+  for( BYTE s = 0; s < numOfSections; s++ )
+  {
+    float q     = 1.0f / ( 2.0f * cosf( (float)M_PI * ( 2*s + 1 ) / ( 4.0f * numOfSections ) ) );
+    float alpha = sinf( w0 ) / ( 2.0f * q );
+    float a0    = 1.0f + alpha;
+
+    short a1 = Dsp::sat16( (int)lroundf( -2.0f * cosf( w0 ) / a0 * 16384.0f ) );
+    short a2 = Dsp::sat16( (int)lroundf( ( 1.0f - alpha ) / a0 * 16384.0f ) );
+
+    // b0 : b1 : b2 = 1 : 2 : 1, rounded such that the DC gain is exactly 1
+    int   sum = 16384 + a1 + a2;
+    short b0  = ( sum + 2 ) / 4;
+
+    set( s, b0, (short)( sum - 2*b0 ), b0, a1, a2 );
+  }
+  reset( 0x8000 );
+}
+
+//-------------------------------------------------------------------
+void Biquad::set( BYTE s, float b0, float b1, float b2, float a1, float a2 )
+{
+  set( s, Dsp::sat16( (int)lroundf( b0 * 16384.0f ) ),
+          Dsp::sat16( (int)lroundf( b1 * 16384.0f ) ),
+          Dsp::sat16( (int)lroundf( b2 * 16384.0f ) ),
+          Dsp::sat16( (int)lroundf( a1 * 16384.0f ) ),
+          Dsp::sat16( (int)lroundf( a2 * 16384.0f ) ) );
+}
+
+//-------------------------------------------------------------------
+void Biquad::set( BYTE s, short b0, short b1, short b2, short a1, short a2 )
+{
+  if( s < MAX_SECTIONS )
+  {
+    section[s].b01  = Dsp::pack( b0, b1 );
+    section[s].b2a1 = Dsp::pack( b2, Dsp::sat16( -a1 ) );
+    section[s].a2   = Dsp::pack( Dsp::sat16( -a2 ), 0 );
+  }
+}
+
+//-------------------------------------------------------------------
+void Biquad::reset( WORD code )
+{
+  // steady state of a DC gain of 1
+  short x = toQ15( code );
+
+  for( BYTE s = 0; s < MAX_SECTIONS; s++ )
+  {
+    section[s].x1 = section[s].x2 = x;
+    section[s].y1 = section[s].y2 = x;
+  }
+}
+
+//-------------------------------------------------------------------
+void Biquad::processBlock( short *x, WORD n )
+{
+  // section by section over the whole block, the state stays in registers
+  for( BYTE s = 0; s < numOfSections; s++ )
+  {
+    Section &sec = section[s];
+
+    short x1 = sec.x1, x2 = sec.x2;
+    short y1 = sec.y1, y2 = sec.y2;
+
+    for( WORD i = 0; i < n; i++ )
+    {
+      int acc = Dsp::mac2( 0,   Dsp::pack( x[i], x1 ), sec.b01 );
+      acc     = Dsp::mac2( acc, Dsp::pack( x2,   y1 ), sec.b2a1 );
+      acc     = Dsp::mac2( acc, Dsp::pack( y2,   0  ), sec.a2 );
+
+      short y = Dsp::sat16( ( acc + ( 1 << 13 ) ) >> 14 );
+
+      x2 = x1;
+      x1 = x[i];
+      y2 = y1;
+      y1 = y;
+
+      x[i] = y;
+    }
+    sec.x1 = x1; sec.x2 = x2;
+    sec.y1 = y1; sec.y2 = y2;
+  }
+}
+
+//*******************************************************************
+//
+// MovingAverage
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+MovingAverage::MovingAverage( BYTE lengthIn )
+{
+  length = ( lengthIn > MAX_LENGTH ) ? (BYTE)MAX_LENGTH
+         : ( lengthIn < 1 )          ? 1
+         :                             lengthIn;
+
+  reset( 0x8000 );
+}
+
+//-------------------------------------------------------------------
+void MovingAverage::reset( WORD code )
+{
+  short x = toQ15( code );
+
+  for( BYTE i = 0; i < length; i++ )
+  {
+    ring[i] = x;
+  }
+  sum = (int)x * length;
+  pos = 0;
+}
+
+//-------------------------------------------------------------------
+void MovingAverage::processBlock( short *x, WORD n )
+{
+  for( WORD i = 0; i < n; i++ )
+  {
+    sum      += x[i] - ring[pos];
+    ring[pos] = x[i];
+    pos       = ( pos + 1 < length ) ? pos + 1 : 0;
+
+    x[i] = sum / length;
+  }
+}
+
+//EOF
@@ -0,0 +1,243 @@
+//*******************************************************************
+/*!
+\file   Filter.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Fixed point FIR, IIR and moving average filters
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_FILTER_H
+#define _SCOPE_FILTER_H
+
+//*******************************************************************
+#include "Dsp.h"
+
+//*******************************************************************
+/*!
+\class Filter
+
+\brief Base class of a filter stage working on raw ADC codes
+
+The codes are converted to Q15 around mid scale, filtered and
+converted back. A capture is processed in place, in blocks of
+BLOCK_SIZE samples:
+\code
+  filter.reset( sample[0] );
+  filter.process( sample, numOfSamples );
+\endcode
+reset() fills the history with the given code, so a capture does not
+start with the transient of a step from zero.
+*/
+class Filter
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      BLOCK_SIZE = 64
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Set the state as if the input has been constant
+        \param code Raw code of the input
+    */
+    virtual void reset( WORD code ) = 0;
+
+    //---------------------------------------------------------------
+    /*! Filter raw samples in place
+        \param sample       Raw samples
+        \param numOfSamples Number of samples
+    */
+    void process( volatile WORD *sample, WORD numOfSamples );
+
+  protected:
+    //---------------------------------------------------------------
+    /*! Filter one block of Q15 values in place
+    */
+    virtual void processBlock( short *x, WORD n ) = 0;
+
+    //---------------------------------------------------------------
+    static short toQ15( WORD code )
+    {
+      return( (short)( code - 0x8000 ) );
+    }
+
+    //---------------------------------------------------------------
+    static WORD toCode( short x )
+    {
+      return( (WORD)( x + 0x8000 ) );
+    }
+
+}; //Filter
+
+//*******************************************************************
+/*!
+\class Fir
+
+\brief Linear phase FIR filter with symmetric taps
+
+Because h[k] = h[N-1-k], the two samples sharing a tap are added
+first. Two of these sums are multiplied and accumulated with one dual
+MAC instruction, so a filter of N taps needs about N/4 instructions
+per sample. The sums are formed from input/2 to avoid an overflow.
+The coefficients are Q15, their sum should not exceed 1.
+*/
+class Fir : public Filter
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      MAX_TAPS = 63
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a windowed sinc low pass
+        \param numOfTaps Number of taps, odd, up to MAX_TAPS
+        \param cutoff    Cutoff frequency relative to the sample
+                         rate [1/1000], e.g. 100 = fs/10
+    */
+    Fir( BYTE numOfTaps, WORD cutoff );
+
+    //---------------------------------------------------------------
+    /*! Instantiate a filter with given taps
+        \param coeff     First half of the taps, including the center
+                         tap, (numOfTaps+1)/2 values in Q15
+        \param numOfTaps Number of taps, odd, up to MAX_TAPS
+    */
+    Fir( const short *coeff, BYTE numOfTaps );
+
+    //---------------------------------------------------------------
+    virtual void reset( WORD code );
+
+  protected:
+    //---------------------------------------------------------------
+    virtual void processBlock( short *x, WORD n );
+
+  private:
+    //---------------------------------------------------------------
+    void init( BYTE numOfTaps );
+
+    //---------------------------------------------------------------
+    void setCoeff( const short *coeff );
+
+  private:
+    //---------------------------------------------------------------
+    BYTE  numOfTaps;
+    DWORD coeff[ MAX_TAPS/4 + 1 ];             // pairs of taps, packed
+    short center;                              // center tap
+    short history[ MAX_TAPS - 1 + BLOCK_SIZE ]; // input/2
+
+}; //Fir
+
+//*******************************************************************
+/*!
+\class Biquad
+
+\brief Cascade of second order IIR sections (direct form I)
+
+Each section computes
+  y = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2
+with coefficients in Q14, so |a1| up to 2 is possible. The five
+products are done with three dual MAC instructions.
+*/
+class Biquad : public Filter
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      MAX_SECTIONS = 4
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a Butterworth like low pass of cascaded sections
+        \param numOfSections Number of sections, up to MAX_SECTIONS
+        \param cutoff        Cutoff frequency relative to the sample
+                             rate [1/1000]
+    */
+    Biquad( BYTE numOfSections, WORD cutoff );
+
+    //---------------------------------------------------------------
+    /*! Set the coefficients of a section, normalized to a0 = 1
+    */
+    void set( BYTE section, float b0, float b1, float b2, float a1, float a2 );
+
+    //---------------------------------------------------------------
+    /*! Set the coefficients of a section in Q14
+    */
+    void set( BYTE section, short b0, short b1, short b2, short a1, short a2 );
+
+    //---------------------------------------------------------------
+    virtual void reset( WORD code );
+
+  protected:
+    //---------------------------------------------------------------
+    virtual void processBlock( short *x, WORD n );
+
+  private:
+    //---------------------------------------------------------------
+    class Section
+    {
+      public:
+        DWORD b01;  // packed (b0,b1)
+        DWORD b2a1; // packed (b2,-a1)
+        DWORD a2;   // packed (-a2,0)
+        short x1;
+        short x2;
+        short y1;
+        short y2;
+    };
+
+    //---------------------------------------------------------------
+    BYTE    numOfSections;
+    Section section[ MAX_SECTIONS ];
+
+}; //Biquad
+
+//*******************************************************************
+/*!
+\class MovingAverage
+
+\brief Mean of the last N samples
+
+The sum is updated by the new and the leaving sample, so the cost
+does not depend on N.
+*/
+class MovingAverage : public Filter
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      MAX_LENGTH = 64
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a moving average
+        \param length Number of averaged samples, up to MAX_LENGTH
+    */
+    MovingAverage( BYTE length );
+
+    //---------------------------------------------------------------
+    virtual void reset( WORD code );
+
+  protected:
+    //---------------------------------------------------------------
+    virtual void processBlock( short *x, WORD n );
+
+  private:
+    //---------------------------------------------------------------
+    BYTE  length;
+    BYTE  pos;
+    int   sum;
+    short ring[ MAX_LENGTH ];
+
+}; //MovingAverage
+
+#endif
@@ -0,0 +1,194 @@
+//*******************************************************************
+/*!
+\file   Gesture.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Touch gesture recognizer with coalescing event queue
+*/
+
+//*******************************************************************
+#include "Gesture.h"
+
+//*******************************************************************
+//
+// Gesture
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Gesture::Gesture( void )
+{
+  reset();
+}
+
+//-------------------------------------------------------------------
+void Gesture::reset( void )
+{
+  numOfContacts = 0;
+  axis          = AXIS_NONE;
+  pinchDistance = 0;
+  isDown        = false;
+  head          = 0;
+  count         = 0;
+}
+
+//-------------------------------------------------------------------
+void Gesture::update( const Pointer::Data &data )
+{
+  if( data.delta != 0 )
+  {
+    push( Event::ZOOM, data.delta );
+  }
+
+  if( data.flags & Pointer::Data::CTRL_DWN )
+  {
+    isDown = true;
+  }
+  if( data.flags & Pointer::Data::CTRL_UP )
+  {
+    isDown = false;
+  }
+
+  if( isDown )
+  {
+    Contact c = { data.posX, data.posY };
+    update( &c, 1 );
+  }
+  else
+  {
+    update( 0, 0 );
+  }
+}
+
+//-------------------------------------------------------------------
+void Gesture::update( const Contact *contact, BYTE num )
+{
+  if( num > 2 )
+  {
+    num = 2;
+  }
+
+  // a new gesture starts, if the number of fingers changes
+  if( num != numOfContacts )
+  {
+    numOfContacts = num;
+    axis          = AXIS_NONE;
+    for( BYTE i = 0; i < num; i++ )
+    {
+      last[i] = contact[i];
+    }
+    if( num > 0 )
+    {
+      start = contact[0];
+    }
+    if( num == 2 )
+    {
+      pinchDistance = distance( contact[0], contact[1] );
+    }
+    return;
+  }
+
+  if( num == 1 )
+  {
+    int dx = contact[0].x - last[0].x;
+    int dy = contact[0].y - last[0].y;
+
+    if( axis == AXIS_NONE )
+    {
+      int sx = contact[0].x - start.x;
+      int sy = contact[0].y - start.y;
+
+      if( sx < 0 ) sx = -sx;
+      if( sy < 0 ) sy = -sy;
+
+      if( sx <= SLOP && sy <= SLOP )
+      {
+        return; // not yet decided, keep last at the start position
+      }
+      axis = ( sx >= sy ) ? AXIS_X : AXIS_Y;
+
+      // the movement within the slop counts, too
+      dx = contact[0].x - start.x;
+      dy = contact[0].y - start.y;
+    }
+
+    if( axis == AXIS_X && dx != 0 ) push( Event::PAN,    dx );
+    if( axis == AXIS_Y && dy != 0 ) push( Event::OFFSET, dy );
+
+    last[0] = contact[0];
+  }
+  else if( num == 2 )
+  {
+    // vertical move of the center
+    int dy = ( contact[0].y + contact[1].y - last[0].y - last[1].y ) / 2;
+    if( dy != 0 )
+    {
+      push( Event::OFFSET, dy );
+      last[0].y = contact[0].y;
+      last[1].y = contact[1].y;
+    }
+
+    // pinch in steps, relative to the distance at the last step
+    int d = distance( contact[0], contact[1] );
+    if( pinchDistance == 0 )
+    {
+      pinchDistance = d; // both at one point, no ratio yet
+    }
+    else if( d * 100 >= pinchDistance * PINCH_STEP )
+    {
+      push( Event::ZOOM, +1 );
+      pinchDistance = d;
+    }
+    else if( d * PINCH_STEP <= pinchDistance * 100 )
+    {
+      push( Event::ZOOM, -1 );
+      pinchDistance = d;
+    }
+  }
+}
+
+//-------------------------------------------------------------------
+bool Gesture::get( Event &event )
+{
+  if( count == 0 )
+  {
+    return( false );
+  }
+  event = queue[head];
+  head  = ( head + 1 ) % QUEUE_SIZE;
+  count--;
+
+  return( true );
+}
+
+//-------------------------------------------------------------------
+void Gesture::push( BYTE type, int value )
+{
+  // merge into the queued event of the same type, if any. With one
+  // entry per type the queue is never full here.
+  for( BYTE i = 0; i < count; i++ )
+  {
+    Event &e = queue[ ( head + i ) % QUEUE_SIZE ];
+    if( e.type == type )
+    {
+      e.value += value;
+      return;
+    }
+  }
+
+  Event &e = queue[ ( head + count ) % QUEUE_SIZE ];
+  e.type  = type;
+  e.value = value;
+  count++;
+}
+
+//-------------------------------------------------------------------
+int Gesture::distance( const Contact &a, const Contact &b )
+{
+  // Manhattan distance, good enough for a ratio and no sqrt needed
+  int dx = a.x - b.x;
+  int dy = a.y - b.y;
+
+  return( ( dx < 0 ? -dx : dx ) + ( dy < 0 ? -dy : dy ) );
+}
+
+//EOF
@@ -0,0 +1,154 @@
+//*******************************************************************
+/*!
+\file   Gesture.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Touch gesture recognizer with coalescing event queue
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_GESTURE_H
+#define _SCOPE_GESTURE_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+
+using namespace EmbSysLib::Hw;
+using namespace EmbSysLib::Dev;
+
+//*******************************************************************
+/*!
+\class Gesture
+
+\brief Recognizes zoom, offset and pan gestures from touch contacts
+
+Gestures:
+- ZOOM:   pinch with two fingers, value in steps (+1: spread by
+          PINCH_STEP percent, -1: pinched by the same ratio). A
+          Pointer::Data::delta (e.g. wheel) is passed as zoom steps, too.
+- OFFSET: vertical drag with two fingers or with one finger, value in
+          pixel (positive: downwards)
+- PAN:    horizontal drag or swipe with one finger, value in pixel
+          (positive: to the right)
+
+A one finger drag is assigned to an axis after it moved more than SLOP
+pixel. Recognized gestures are put into a small queue with one entry
+per type, in the order of their first occurrence. An event of a type
+already queued is merged into that entry. So the queue never
+overflows, no gesture is lost and the consumer sees only the sum of
+all moves since its last call.
+Typical use, once per frame:
+\code
+  gesture.update( pointer.get() );
+
+  Gesture::Event event;
+  while( gesture.get( event ) )
+  {
+    // apply event.type and event.value to the view state
+  }
+  // re-render once, if the state changed
+\endcode
+Pointer only reports one contact. A touch driver reporting two
+contacts can feed them via update( contact, 2 ).
+*/
+class Gesture
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Position of a finger
+    */
+    class Contact
+    {
+      public:
+        int x;
+        int y;
+    };
+
+    //---------------------------------------------------------------
+    /*! Recognized gesture
+    */
+    class Event
+    {
+      public:
+        enum Type
+        {
+          NONE = 0,
+          ZOOM,
+          OFFSET,
+          PAN
+        };
+
+        BYTE type;
+        int  value;
+    };
+
+    //---------------------------------------------------------------
+    enum
+    {
+      QUEUE_SIZE = Event::PAN, //!< One entry per type
+      SLOP       = 8,          //!< Movement [px] before a drag gets an axis
+      PINCH_STEP = 150         //!< Distance ratio [%] of one zoom step
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a recognizer
+    */
+    Gesture( void );
+
+    //---------------------------------------------------------------
+    /*! Process a pointer sample (one contact)
+    */
+    void update( const Pointer::Data &data );
+
+    //---------------------------------------------------------------
+    /*! Process the actual contacts
+        \param contact       Positions of the fingers
+        \param numOfContacts Number of fingers (0: released)
+    */
+    void update( const Contact *contact, BYTE numOfContacts );
+
+    //---------------------------------------------------------------
+    /*! Get the next event
+        \return false, if the queue is empty
+    */
+    bool get( Event &event );
+
+    //---------------------------------------------------------------
+    /*! Discard all queued events and the actual gesture
+    */
+    void reset( void );
+
+  private:
+    //---------------------------------------------------------------
+    void push( BYTE type, int value );
+
+    //---------------------------------------------------------------
+    static int distance( const Contact &a, const Contact &b );
+
+  private:
+    //---------------------------------------------------------------
+    enum
+    {
+      AXIS_NONE = 0,
+      AXIS_X,
+      AXIS_Y
+    };
+
+    //---------------------------------------------------------------
+    // actual gesture
+    BYTE    numOfContacts;
+    Contact last[2];
+    Contact start;
+    BYTE    axis;
+    int     pinchDistance;
+    bool    isDown;
+
+    // event queue
+    Event   queue[QUEUE_SIZE];
+    BYTE    head;
+    BYTE    count;
+
+}; //Gesture
+
+#endif
@@ -0,0 +1,314 @@
+//*******************************************************************
+/*!
+\file   Histogram.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Amplitude and edge time histograms across captures
+*/
+
+//*******************************************************************
+#include <math.h>
+
+#include "Histogram.h"
+
+//*******************************************************************
+//
+// Histogram::Statistics
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+void Histogram::Statistics::reset( void )
+{
+  count = 0;
+  mean  = 0.0;
+  m2    = 0.0;
+  min   = 0.0;
+  max   = 0.0;
+}
+
+//-------------------------------------------------------------------
+void Histogram::Statistics::add( double x )
+{
+  merge( 1, x, 0.0, x, x );
+}
+
+//-------------------------------------------------------------------
+void Histogram::Statistics::merge( DWORD  n,
+                                   double meanIn,
+                                   double m2In,
+                                   double minIn,
+                                   double maxIn )
+{
+  if( n == 0 )
+  {
+    return;
+  }
+  if( count == 0 )
+  {
+    min = minIn;
+    max = maxIn;
+  }
+  else
+  {
+    if( minIn < min ) min = minIn;
+    if( maxIn > max ) max = maxIn;
+  }
+
+  // combination of two groups (Chan et al.), Welford for n = 1
+  double total = (double)count + n;
+  double delta = meanIn - mean;
+
+  mean  += delta * n / total;
+  m2    += m2In + delta * delta * count * n / total;
+  count += n;
+}
+
+//-------------------------------------------------------------------
+double Histogram::Statistics::getSigma( void ) const
+{
+  return( ( count > 1 ) ? sqrt( m2 / ( count - 1 ) ) : 0.0 );
+}
+
+//*******************************************************************
+//
+// Histogram
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Histogram::Histogram( const Trace::Calibration &calIn, WORD samplePeriodIn )
+{
+  cal          = calIn;
+  samplePeriod = samplePeriodIn;
+  timeStart    = 0;
+  timeSpan     = 0;
+
+  reset();
+}
+
+//-------------------------------------------------------------------
+void Histogram::setTimeWindow( WORD start, WORD span )
+{
+  timeStart = (DWORD)start * FRAC;
+  timeSpan  = (DWORD)span  * FRAC;
+
+  for( WORD i = 0; i < NUM_OF_TIME_BINS; i++ )
+  {
+    timeBin[i] = 0;
+  }
+  edge.reset();
+}
+
+//-------------------------------------------------------------------
+void Histogram::reset( void )
+{
+  for( WORD i = 0; i < NUM_OF_BINS; i++ )
+  {
+    bin[i] = 0;
+  }
+  for( WORD i = 0; i < NUM_OF_TIME_BINS; i++ )
+  {
+    timeBin[i] = 0;
+  }
+  amplitude.reset();
+  edge.reset();
+  numOfCaptures = 0;
+}
+
+//-------------------------------------------------------------------
+void Histogram::add( const volatile WORD  *sample,
+                     WORD                  numOfSamples,
+                     const Trace::Column  &range )
+{
+  if( numOfSamples == 0 )
+  {
+    return;
+  }
+
+  // edge levels: hysteresis 30% ... 70%, time at 50%
+  int  swing  = range.max - range.min;
+  int  lo     = range.min + swing * 3 / 10;
+  int  mid    = range.min + swing / 2;
+  int  hi     = range.max - swing * 3 / 10;
+  bool timing = ( swing >= 0x200 );
+
+  DWORD              sum     = 0;
+  unsigned long long sumSq   = 0;
+  bool               isHigh  = ( sample[0] > mid );
+  DWORD              tMid    = 0;
+  DWORD              trigger = 0;
+  bool               isTriggered = false;
+  DWORD              dtFirst = 0; // first edge after the trigger
+  int                prev    = sample[0];
+
+  for( WORD i = 0; i < numOfSamples; i++ )
+  {
+    int c = sample[i];
+
+    bin[c >> BIN_SHIFT]++;
+    sum   += c;
+    sumSq += (DWORD)c * c;
+
+    if( timing )
+    {
+      if( !isHigh )
+      {
+        if( prev < mid && c >= mid )
+        {
+          tMid = (DWORD)( i - 1 ) * FRAC + (DWORD)( mid - prev ) * FRAC / ( c - prev );
+        }
+        if( c >= hi ) // rising edge complete
+        {
+          isHigh = true;
+
+          if( !isTriggered )
+          {
+            trigger     = tMid;
+            isTriggered = true;
+          }
+          else
+          {
+            DWORD dt = tMid - trigger;
+
+            if( dtFirst == 0 )
+            {
+              dtFirst = dt;
+            }
+            if( timeSpan > 0 && dt >= timeStart && dt - timeStart < timeSpan )
+            {
+              timeBin[ ( dt - timeStart ) * NUM_OF_TIME_BINS / timeSpan ]++;
+              edge.add( dt );
+            }
+          }
+        }
+      }
+      else if( c <= lo )
+      {
+        isHigh = false;
+      }
+    }
+    prev = c;
+  }
+
+  // window of the edge time histogram from the first capture with a period
+  if( timeSpan == 0 && dtFirst > 0 )
+  {
+    timeStart = dtFirst / 2;
+    timeSpan  = dtFirst;
+  }
+
+  // merge the statistics of this capture
+  double n    = numOfSamples;
+  double mean = sum / n;
+  double m2   = (double)sumSq - (double)sum * mean;
+
+  amplitude.merge( numOfSamples, mean, ( m2 > 0.0 ) ? m2 : 0.0, range.min, range.max );
+  numOfCaptures++;
+}
+
+//-------------------------------------------------------------------
+void Histogram::drawAmplitude( ScreenGraphic       &screen,
+                               const Trace::Window &window,
+                               WORD                 width,
+                               WORD                 color,
+                               WORD                 back ) const
+{
+  Trace::Scale scale( window, cal );
+
+  DWORD max = 1;
+  for( WORD b = 0; b < NUM_OF_BINS; b++ )
+  {
+    if( bin[b] > max ) max = bin[b];
+  }
+
+  WORD xRight = window.x + window.width - 1;
+  WORD xLeft  = xRight - width + 1;
+
+  // one bar per bin, all rows of the bin get the same length
+  for( WORD b = 0; b < NUM_OF_BINS; b++ )
+  {
+    WORD y0 = scale.toY( ( (DWORD)( b + 1 ) << BIN_SHIFT ) - 1 );
+    WORD y1 = scale.toY(   (DWORD)  b       << BIN_SHIFT       );
+    WORD len = (DWORD)bin[b] * width / max;
+
+    for( WORD y = y0; y <= y1; y++ )
+    {
+      if( len < width )
+      {
+        screen.drawLine( xLeft, y, xRight - len, y, 1, back );
+      }
+      if( len > 0 )
+      {
+        screen.drawLine( xRight - len + 1, y, xRight, y, 1, color );
+      }
+    }
+  }
+}
+
+//-------------------------------------------------------------------
+void Histogram::drawTime( ScreenGraphic       &screen,
+                          const Trace::Region &area,
+                          WORD                 color,
+                          WORD                 back ) const
+{
+  DWORD max = 1;
+  for( WORD b = 0; b < NUM_OF_TIME_BINS; b++ )
+  {
+    if( timeBin[b] > max ) max = timeBin[b];
+  }
+
+  WORD width  = area.x1 - area.x0 + 1;
+  WORD height = area.y1 - area.y0 + 1;
+
+  for( WORD x = area.x0; x <= area.x1; x++ )
+  {
+    WORD b   = (DWORD)( x - area.x0 ) * NUM_OF_TIME_BINS / width;
+    WORD len = (DWORD)timeBin[b] * height / max;
+
+    if( len < height )
+    {
+      screen.drawLine( x, area.y0, x, area.y1 - len, 1, back );
+    }
+    if( len > 0 )
+    {
+      screen.drawLine( x, area.y1 - len + 1, x, area.y1, 1, color );
+    }
+  }
+}
+
+//-------------------------------------------------------------------
+void Histogram::drawStatistics( ScreenGraphic &screen, WORD x, WORD y ) const
+{
+  // amplitude [0.1 mV]
+  double k     = cal.fullScale / 65536.0;
+  int    mean  = (int)lround( ( cal.offset + amplitude.getMean() * k ) * 10.0 );
+  int    sigma = (int)lround( amplitude.getSigma()      * k * 10.0 );
+  int    pp    = (int)lround( amplitude.getPeakToPeak() * k * 10.0 );
+
+  screen.drawText( x, y, "captures %d   ", (int)numOfCaptures );
+  y += LINE_HEIGHT;
+
+  screen.drawText( x, y, "mean %s%d.%dmV sigma %d.%dmV pp %d.%dmV   ",
+                   ( mean < 0 ) ? "-" : "", abs( mean ) / 10, abs( mean ) % 10,
+                   sigma / 10, sigma % 10,
+                   pp / 10,    pp % 10 );
+  y += LINE_HEIGHT;
+
+  // edge time [0.1 us]
+  if( edge.getCount() == 0 )
+  {
+    screen.drawText( x, y, "edge ---                                " );
+    return;
+  }
+
+  double t     = samplePeriod * 10.0 / FRAC;
+  int    tMean = (int)lround( edge.getMean()       * t );
+  int    tSig  = (int)lround( edge.getSigma()      * t );
+  int    tPp   = (int)lround( edge.getPeakToPeak() * t );
+
+  screen.drawText( x, y, "edge %d.%dus sigma %d.%dus pp %d.%dus   ",
+                   tMean / 10, tMean % 10,
+                   tSig  / 10, tSig  % 10,
+                   tPp   / 10, tPp   % 10 );
+}
+
+//EOF
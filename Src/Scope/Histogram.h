@@ -0,0 +1,184 @@
+//*******************************************************************
+/*!
+\file   Histogram.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Amplitude and edge time histograms across captures
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_HISTOGRAM_H
+#define _SCOPE_HISTOGRAM_H
+
+//*******************************************************************
+#include "Trace.h"
+
+//*******************************************************************
+/*!
+\class Histogram
+
+\brief Distribution of the sample values and of the edge times of
+       many captures
+
+Amplitude: every raw code increments one of NUM_OF_BINS bins. The
+mean and variance of a capture are summed up in integers and then
+merged into the running statistics (Welford/Chan). So noise figures
+cover all captures, not only the last one.
+
+Edge time: the first rising edge of a capture is taken as trigger.
+The times of the following rising edges (50% crossing, interpolated)
+inside a time window relative to it are sorted into NUM_OF_TIME_BINS
+bins. Their statistics give the jitter. Without setTimeWindow() the
+window is set by the first capture to 0.5 ... 1.5 periods, so it
+shows the period jitter.
+*/
+class Histogram
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Running mean, variance and range (Welford)
+    */
+    class Statistics
+    {
+      public:
+        //-----------------------------------------------------------
+        Statistics( void )
+        {
+          reset();
+        }
+
+        //-----------------------------------------------------------
+        void reset( void );
+
+        //-----------------------------------------------------------
+        /*! Add one value
+        */
+        void add( double x );
+
+        //-----------------------------------------------------------
+        /*! Add a group of values, given by their statistics
+            \param n    Number of values
+            \param mean Mean of the values
+            \param m2   Sum of squared deviations from their mean
+            \param min  Smallest value
+            \param max  Largest value
+        */
+        void merge( DWORD n, double mean, double m2, double min, double max );
+
+        //-----------------------------------------------------------
+        DWORD getCount( void ) const
+        {
+          return( count );
+        }
+
+        //-----------------------------------------------------------
+        double getMean       ( void ) const { return( mean ); }
+        double getSigma      ( void ) const;
+        double getPeakToPeak ( void ) const { return( count ? max - min : 0.0 ); }
+
+      private:
+        //-----------------------------------------------------------
+        DWORD  count;
+        double mean;
+        double m2;
+        double min;
+        double max;
+    };
+
+    //---------------------------------------------------------------
+    enum
+    {
+      NUM_OF_BINS      = 128,
+      BIN_SHIFT        = 9,    //!< code >> BIN_SHIFT is the bin
+      NUM_OF_TIME_BINS = 128,
+      FRAC             = 256,  //!< Sub-sample resolution of the edge times
+      LINE_HEIGHT      = 20    //!< Text line height [px], fits Font_10x20
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate empty histograms
+        \param cal          Calibration of the codes
+        \param samplePeriod Sample period [us]
+    */
+    Histogram( const Trace::Calibration &cal, WORD samplePeriod );
+
+    //---------------------------------------------------------------
+    /*! Set the window of the edge time histogram, relative to the
+        first rising edge, and clear it
+        \param start Start [samples]
+        \param span  Width [samples]
+    */
+    void setTimeWindow( WORD start, WORD span );
+
+    //---------------------------------------------------------------
+    /*! Clear both histograms and all statistics
+    */
+    void reset( void );
+
+    //---------------------------------------------------------------
+    /*! Add a capture
+        \param sample       Raw samples
+        \param numOfSamples Number of samples
+        \param range        Min/max code of the samples
+    */
+    void add( const volatile WORD  *sample,
+              WORD                  numOfSamples,
+              const Trace::Column  &range );
+
+    //---------------------------------------------------------------
+    DWORD getNumOfCaptures( void ) const
+    {
+      return( numOfCaptures );
+    }
+
+    //---------------------------------------------------------------
+    /*! Draw the amplitude histogram as horizontal bars at the right
+        border of a window, aligned to its voltage axis
+        \param screen Target screen
+        \param window Window of the trace
+        \param width  Width of the panel [px]
+        \param color  Bar color
+        \param back   Background color
+    */
+    void drawAmplitude( ScreenGraphic       &screen,
+                        const Trace::Window &window,
+                        WORD                 width,
+                        WORD                 color,
+                        WORD                 back ) const;
+
+    //---------------------------------------------------------------
+    /*! Draw the edge time histogram as vertical bars
+        \param screen Target screen
+        \param area   Panel, the width should be a multiple of
+                      NUM_OF_TIME_BINS or larger
+        \param color  Bar color
+        \param back   Background color
+    */
+    void drawTime( ScreenGraphic       &screen,
+                   const Trace::Region &area,
+                   WORD                 color,
+                   WORD                 back ) const;
+
+    //---------------------------------------------------------------
+    /*! Print the statistics, 3 lines of LINE_HEIGHT
+    */
+    void drawStatistics( ScreenGraphic &screen, WORD x, WORD y ) const;
+
+  private:
+    //---------------------------------------------------------------
+    Trace::Calibration cal;
+    WORD               samplePeriod;
+
+    DWORD              bin    [NUM_OF_BINS];
+    DWORD              timeBin[NUM_OF_TIME_BINS];
+    DWORD              timeStart;  // [1/FRAC sample]
+    DWORD              timeSpan;   // [1/FRAC sample]
+
+    Statistics         amplitude;  // [code]
+    Statistics         edge;       // [1/FRAC sample]
+    DWORD              numOfCaptures;
+
+}; //Histogram
+
+#endif
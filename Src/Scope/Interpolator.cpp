@@ -0,0 +1,182 @@
+//*******************************************************************
+/*!
+\file   Interpolator.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Sin(x)/x and linear reconstruction of sparse samples
+*/
+
+//*******************************************************************
+#include <math.h>
+
+#include "Interpolator.h"
+
+//*******************************************************************
+//
+// Interpolator
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Interpolator::Interpolator( WORD maxNumOfPointsIn )
+{
+  maxNumOfPoints = maxNumOfPointsIn;
+  result         = new WORD[ maxNumOfPoints ];
+  mode           = SINC;
+  isValid        = false;
+  first          = 0;
+  count          = 0;
+  numOfPoints    = 0;
+
+  // Lanczos window, a = TAPS/2. Phase p is the position p/PHASES
+  // behind sample TAPS/2-1 of the taps. Computed once, so float is
+  // acceptable here
+  const float a = TAPS/2;
+
+  for( WORD p = 0; p < PHASES; p++ )
+  {
+    float h[TAPS];
+    float sum = 0.0f;
+
+    for( WORD k = 0; k < TAPS; k++ )
+    {
+      float x = (float)k - ( TAPS/2 - 1 ) - (float)p / PHASES;
+      float w = 1.0f;
+
+      if( fabsf( x ) > 1e-6f )
+      {
+        float px = (float)M_PI * x;
+        w = a * sinf( px ) * sinf( px / a ) / ( px * px );
+      }
+      h[k] = w;
+      sum += w;
+    }
+
+    // normalized to a DC gain of exactly 1.0, the rounding error is
+    // put into the largest coefficient
+    short q[TAPS];
+    int   qSum = 0;
+    WORD  kMax = 0;
+
+    for( WORD k = 0; k < TAPS; k++ )
+    {
+      q[k]  = Dsp::sat16( (int)lroundf( h[k] / sum * 16384.0f ) );
+      qSum += q[k];
+      if( q[k] > q[kMax] ) kMax = k;
+    }
+    q[kMax] += 16384 - qSum;
+
+    for( WORD k = 0; k < TAPS/2; k++ )
+    {
+      coeff[p][k] = Dsp::pack( q[2*k], q[2*k + 1] );
+    }
+  }
+}
+
+//-------------------------------------------------------------------
+void Interpolator::setMode( BYTE modeIn )
+{
+  mode    = ( modeIn < NUM_OF_MODES ) ? modeIn : (BYTE)NONE;
+  isValid = false;
+}
+
+//-------------------------------------------------------------------
+const char *Interpolator::getName( BYTE m )
+{
+  static const char *name[NUM_OF_MODES] =
+  {
+    "dots", "linear", "sin(x)/x"
+  };
+  return( ( m < NUM_OF_MODES ) ? name[m] : "" );
+}
+
+//-------------------------------------------------------------------
+const WORD *Interpolator::get( const volatile WORD *sample,
+                               WORD                 numOfSamples,
+                               DWORD                firstIn,
+                               DWORD                countIn,
+                               WORD                 numOfPointsIn )
+{
+  if( numOfPointsIn > maxNumOfPoints )
+  {
+    numOfPointsIn = maxNumOfPoints;
+  }
+
+  if(    !isValid
+      || firstIn       != first
+      || countIn       != count
+      || numOfPointsIn != numOfPoints )
+  {
+    first       = firstIn;
+    count       = countIn;
+    numOfPoints = numOfPointsIn;
+    compute( sample, numOfSamples );
+    isValid = true;
+  }
+  return( result );
+}
+
+//-------------------------------------------------------------------
+void Interpolator::compute( const volatile WORD *sample, WORD numOfSamples )
+{
+  if( numOfSamples == 0 || numOfPoints == 0 )
+  {
+    return;
+  }
+
+  // position of a point in 1/65536 sample
+  DWORD step = ( count << 16 ) / numOfPoints;
+  DWORD pos  = first << 16;
+  int   last = numOfSamples - 1;
+
+  for( WORD x = 0; x < numOfPoints; x++, pos += step )
+  {
+    int  i    = pos >> 16;
+    WORD frac = pos & 0xFFFF;
+
+    if( i > last )
+    {
+      i = last;
+    }
+
+    switch( mode )
+    {
+      default:
+        result[x] = sample[i];
+        break;
+
+      case LINEAR:
+      {
+        int s0 = sample[i];
+        int s1 = sample[ ( i < last ) ? i + 1 : last ];
+
+        result[x] = s0 + ( ( s1 - s0 ) * ( frac >> 4 ) >> 12 );
+        break;
+      }
+
+      case SINC:
+      {
+        // nearest phase, the taps start TAPS/2-1 samples before i.
+        // The samples are centered, so they fit into Q15
+        const DWORD *c   = coeff[ frac >> ( 16 - PHASE_BITS ) ];
+        int          acc = 0;
+        int          j   = i - ( TAPS/2 - 1 );
+
+        for( WORD k = 0; k < TAPS/2; k++, j += 2 )
+        {
+          int j0 = ( j     < 0 ) ? 0 : ( j     > last ) ? last : j;
+          int j1 = ( j + 1 < 0 ) ? 0 : ( j + 1 > last ) ? last : j + 1;
+
+          acc = Dsp::mac2( acc,
+                           Dsp::pack( (int)sample[j0] - 0x8000, (int)sample[j1] - 0x8000 ),
+                           c[k] );
+        }
+
+        // overshoot of the ringing is clipped to the code range
+        result[x] = Dsp::sat16( ( acc + ( 1 << 13 ) ) >> 14 ) + 0x8000;
+        break;
+      }
+    }
+  }
+}
+
+//EOF
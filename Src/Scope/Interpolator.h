@@ -0,0 +1,127 @@
+//*******************************************************************
+/*!
+\file   Interpolator.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Sin(x)/x and linear reconstruction of sparse samples
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_INTERPOLATOR_H
+#define _SCOPE_INTERPOLATOR_H
+
+//*******************************************************************
+#include "Dsp.h"
+
+//*******************************************************************
+/*!
+\class Interpolator
+
+\brief Upsamples a sample range to one point per pixel column
+
+Used, if a window shows less samples than it has columns. Point x of
+numOfPoints is taken at the sample position first + x*count/numOfPoints,
+so sample i stays at the same column as in an undecimated view.
+
+Modes:
+- LINEAR: straight lines between the samples
+- SINC:   band limited reconstruction with a windowed sinc (Lanczos,
+          TAPS samples), as polyphase filter of PHASES phases. The
+          coefficients are Q14, computed once by the constructor and
+          normalized per phase, so a DC level is kept exactly. The
+          samples are combined in pairs with the dual 16 bit MAC (see
+          Dsp).
+
+The result is computed lazily: invalidate() marks a new capture, the
+next get() computes it once. It is computed again only if the range
+or the mode changed, so redraws of the same view cost nothing.
+*/
+class Interpolator
+{
+  public:
+    //---------------------------------------------------------------
+    enum Mode
+    {
+      NONE = 0,
+      LINEAR,
+      SINC,
+      NUM_OF_MODES
+    };
+
+    //---------------------------------------------------------------
+    enum
+    {
+      TAPS       = 8,   //!< Samples per point, even
+      PHASES     = 32,  //!< Sub-sample positions of the polyphase filter
+      PHASE_BITS = 5    //!< log2(PHASES)
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate an interpolator
+        \param maxNumOfPoints Max. number of points, e.g. window width
+    */
+    Interpolator( WORD maxNumOfPoints );
+
+    //---------------------------------------------------------------
+    /*! Select the mode
+    */
+    void setMode( BYTE mode );
+
+    //---------------------------------------------------------------
+    BYTE getMode( void ) const
+    {
+      return( mode );
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the name of a mode
+    */
+    static const char *getName( BYTE mode );
+
+    //---------------------------------------------------------------
+    /*! Mark the result as outdated, e.g. after a new capture
+    */
+    void invalidate( void )
+    {
+      isValid = false;
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the interpolated points of a sample range
+        \param sample       Raw samples of the capture
+        \param numOfSamples Number of samples of the capture
+        \param first        Index of the first visible sample
+        \param count        Number of visible samples
+        \param numOfPoints  Number of points, at most maxNumOfPoints
+        \return Raw codes, numOfPoints values. With mode NONE the
+                nearest samples are repeated.
+    */
+    const WORD *get( const volatile WORD *sample,
+                     WORD                 numOfSamples,
+                     DWORD                first,
+                     DWORD                count,
+                     WORD                 numOfPoints );
+
+  private:
+    //---------------------------------------------------------------
+    void compute( const volatile WORD *sample, WORD numOfSamples );
+
+  private:
+    //---------------------------------------------------------------
+    BYTE   mode;
+    WORD   maxNumOfPoints;
+    WORD  *result;
+
+    // polyphase table, packed pairs of Q14 coefficients
+    DWORD  coeff[PHASES][TAPS/2];
+
+    // range of the actual result
+    bool   isValid;
+    DWORD  first;
+    DWORD  count;
+    WORD   numOfPoints;
+
+}; //Interpolator
+
+#endif
@@ -0,0 +1,215 @@
+//*******************************************************************
+/*!
+\file   Layout.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Compile time display layout (grid, ticks, labels, scaling)
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_LAYOUT_H
+#define _SCOPE_LAYOUT_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+
+//*******************************************************************
+/*!
+\class DivTable
+
+\brief Compile time table of division values (e.g. mV/div or us/div)
+
+\code
+  typedef DivTable<500,1000,2000> VoltPerDiv; // mV/div
+\endcode
+*/
+template <int... VALUE> class DivTable
+{
+  public:
+    //---------------------------------------------------------------
+    static constexpr BYTE size = sizeof...(VALUE);
+
+    //---------------------------------------------------------------
+    static constexpr int get( BYTE idx )
+    {
+      const int table[] = { VALUE... };
+      return( table[idx] );
+    }
+
+    //---------------------------------------------------------------
+    static constexpr int min( void )
+    {
+      int ret = get( 0 );
+      for( BYTE i = 1; i < size; i++ )
+      {
+        if( get( i ) < ret ) ret = get( i );
+      }
+      return( ret );
+    }
+
+    //---------------------------------------------------------------
+    static constexpr int max( void )
+    {
+      int ret = get( 0 );
+      for( BYTE i = 1; i < size; i++ )
+      {
+        if( get( i ) > ret ) ret = get( i );
+      }
+      return( ret );
+    }
+
+    //---------------------------------------------------------------
+    static constexpr bool isMultipleOf( int n )
+    {
+      for( BYTE i = 0; i < size; i++ )
+      {
+        if( get( i ) % n != 0 )
+        {
+          return( false );
+        }
+      }
+      return( true );
+    }
+
+}; //DivTable
+
+//*******************************************************************
+/*!
+\class LayoutPositions
+
+\brief Equidistant pixel positions, built at compile time
+*/
+template <WORD N> class LayoutPositions
+{
+  public:
+    //---------------------------------------------------------------
+    constexpr LayoutPositions( int first, int step )
+    : pos()
+    {
+      for( WORD i = 0; i < N; i++ )
+      {
+        pos[i] = first + i*step;
+      }
+    }
+
+    //---------------------------------------------------------------
+    constexpr WORD operator[]( WORD idx ) const
+    {
+      return( pos[idx] );
+    }
+
+    //---------------------------------------------------------------
+    static constexpr WORD size = N;
+
+  private:
+    //---------------------------------------------------------------
+    WORD pos[N];
+
+}; //LayoutPositions
+
+//*******************************************************************
+/*!
+\class Layout
+
+\brief Geometry of the scope screen
+
+All positions are derived at compile time from the panel size and the
+grid. Integer scaling is checked by static assertions, so a layout,
+which does not map every division to a whole number of pixels and
+samples, is rejected by the compiler.
+
+\param WIDTH,HEIGHT Panel size [px]
+\param VDIV         DivTable with the selectable mV/div
+\param TDIV         DivTable with the selectable us/div
+\param DIV_X,DIV_Y  Number of grid divisions (even)
+\param DASH         Length of a tick dash [px]
+*/
+template < WORD WIDTH,
+           WORD HEIGHT,
+           class VDIV,
+           class TDIV,
+           BYTE DIV_X = 10,
+           BYTE DIV_Y = 10,
+           BYTE DASH  = 10 >
+class Layout
+{
+  public:
+    //---------------------------------------------------------------
+    // panel
+    static constexpr WORD width   = WIDTH;
+    static constexpr WORD height  = HEIGHT;
+    static constexpr WORD xmax    = WIDTH  - 1;
+    static constexpr WORD ymax    = HEIGHT - 1;
+    static constexpr WORD xCenter = xmax/2;
+    static constexpr WORD yCenter = ymax/2;
+
+    //---------------------------------------------------------------
+    // grid
+    static constexpr BYTE divX         = DIV_X;
+    static constexpr BYTE divY         = DIV_Y;
+    static constexpr WORD pixelPerDivX = xmax / DIV_X;
+    static constexpr WORD pixelPerDivY = ymax / DIV_Y;
+    static constexpr WORD dashWidth    = DASH;
+
+    static constexpr WORD firstLabel = xCenter - (DIV_X/2) * pixelPerDivX; //!< x of first time tick
+    static constexpr WORD lastLabel  = firstLabel + DIV_X * pixelPerDivX;  //!< x of last time tick
+    static constexpr WORD yTop       = yCenter - (DIV_Y/2) * pixelPerDivY; //!< y of top voltage tick
+    static constexpr WORD yBottom    = yTop    +  DIV_Y    * pixelPerDivY; //!< y of bottom voltage tick
+
+    //---------------------------------------------------------------
+    // one sample per pixel column from firstLabel to lastLabel
+    static constexpr WORD sampleSize = lastLabel - firstLabel;
+
+    //---------------------------------------------------------------
+    /*! Sample period [us] of an entry of the time/div table
+    */
+    static constexpr DWORD samplePeriod( BYTE tdiv )
+    {
+      return( TDIV::get( tdiv ) / pixelPerDivX );
+    }
+
+    //---------------------------------------------------------------
+    /*! Time [us] at pixel column x, relative to firstLabel
+    */
+    static constexpr int timeAt( WORD x, BYTE tdiv )
+    {
+      return( ((int)x - firstLabel) * (int)samplePeriod( tdiv ) );
+    }
+
+    //---------------------------------------------------------------
+    /*! Voltage [mV] at the top/bottom tick for an entry of the V/div table
+    */
+    static constexpr int mVTop   ( BYTE vdiv ) { return(  (DIV_Y/2) * VDIV::get( vdiv ) ); }
+    static constexpr int mVBottom( BYTE vdiv ) { return( -(DIV_Y/2) * VDIV::get( vdiv ) ); }
+
+    //---------------------------------------------------------------
+    // tick and label positions
+    static constexpr LayoutPositions<DIV_X+1> xTick { firstLabel, pixelPerDivX };
+    static constexpr LayoutPositions<DIV_Y+1> yTick { yTop,       pixelPerDivY };
+
+    static constexpr int  xTimeLabelOffset = -5;  //!< relative to xTick
+    static constexpr WORD yTimeLabel       = yCenter - DASH/2 + 15;
+    static constexpr WORD xVoltLabel       = xCenter - DASH/2 - 30;
+    static constexpr int  yVoltLabelOffset = -10; //!< relative to yTick
+
+
+  private:
+    //---------------------------------------------------------------
+    static_assert( DIV_X % 2 == 0 && DIV_Y % 2 == 0,     "Layout: number of divisions must be even" );
+    static_assert( pixelPerDivX > 0 && pixelPerDivY > 0, "Layout: panel too small for the grid" );
+    static_assert( xVoltLabel < xCenter,                 "Layout: no room for voltage labels" );
+    static_assert( yBottom <= ymax,                      "Layout: grid exceeds panel height" );
+    static_assert( TDIV::min() > 0 && VDIV::min() > 0,   "Layout: divisions must be positive" );
+    static_assert( TDIV::isMultipleOf( pixelPerDivX ),   "Layout: us/div is not a multiple of pixel/div" );
+
+}; //Layout
+
+//*******************************************************************
+// definitions of the odr-used constexpr members
+template <WORD W, WORD H, class V, class T, BYTE X, BYTE Y, BYTE D>
+constexpr LayoutPositions<X+1> Layout<W,H,V,T,X,Y,D>::xTick;
+
+template <WORD W, WORD H, class V, class T, BYTE X, BYTE Y, BYTE D>
+constexpr LayoutPositions<Y+1> Layout<W,H,V,T,X,Y,D>::yTick;
+
+#endif
@@ -0,0 +1,206 @@
+//*******************************************************************
+/*!
+\file   Mask.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Pass/fail test of captures against an envelope mask
+*/
+
+//*******************************************************************
+#include "Mask.h"
+
+//*******************************************************************
+//
+// Mask
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Mask::Mask( Memory &memIn, DWORD addrIn, WORD numOfColumnsIn )
+
+: mem ( memIn  ),
+  addr( addrIn )
+
+{
+  numOfColumns = numOfColumnsIn;
+  lower        = new WORD[ numOfColumns ];
+  upper        = new WORD[ numOfColumns ];
+  column       = new Trace::Column[ numOfColumns ];
+
+  resetCounters();
+  load();
+}
+
+//-------------------------------------------------------------------
+bool Mask::load( void )
+{
+  valid = false;
+
+  if( mem.read( addr ) != MAGIC )
+  {
+    return( false );
+  }
+
+  numOfSamples = mem.read( addr + 2 ) | ((WORD)mem.read( addr + 3 ) << 8);
+
+  BYTE checksum = 0;
+  for( WORD i = 0; i < NUM_OF_POINTS; i++ )
+  {
+    BYTE lo = mem.read( addr + HEADER_SIZE + 2*i     );
+    BYTE hi = mem.read( addr + HEADER_SIZE + 2*i + 1 );
+
+    checksum ^= lo ^ hi;
+
+    // the limits were rounded outwards when stored
+    point[i].min = (WORD)lo << 8;
+    point[i].max = ((WORD)hi << 8) | 0xFF;
+  }
+  valid = ( checksum == mem.read( addr + 1 ) );
+
+  if( valid )
+  {
+    expand();
+  }
+  return( valid );
+}
+
+//-------------------------------------------------------------------
+void Mask::create( const Pyramid &pyramid,
+                   WORD           numOfSamplesIn,
+                   WORD           tolerance,
+                   BYTE           timeTolerance )
+{
+  Trace::Column ref[NUM_OF_POINTS];
+
+  numOfSamples = numOfSamplesIn;
+  pyramid.decimate( 0, numOfSamples, ref, NUM_OF_POINTS );
+
+  // widen in time: min/max over the neighbouring points, then in value
+  for( WORD i = 0; i < NUM_OF_POINTS; i++ )
+  {
+    WORD first = ( i > timeTolerance ) ? i - timeTolerance : 0;
+    WORD last  = ( i + timeTolerance < NUM_OF_POINTS ) ? i + timeTolerance : NUM_OF_POINTS - 1;
+    WORD lo    = 0xFFFF;
+    WORD hi    = 0;
+
+    for( WORD k = first; k <= last; k++ )
+    {
+      if( ref[k].min < lo ) lo = ref[k].min;
+      if( ref[k].max > hi ) hi = ref[k].max;
+    }
+    point[i].min = ( lo > tolerance )          ? lo - tolerance : 0;
+    point[i].max = ( hi < 0xFFFF - tolerance ) ? hi + tolerance : 0xFFFF;
+  }
+
+  valid = true;
+  store();
+  load(); // the same 8 bit limits as after a restart
+
+  resetCounters();
+}
+
+//-------------------------------------------------------------------
+bool Mask::test( const Pyramid &pyramid, WORD numOfSamplesIn )
+{
+  if( !valid || numOfSamplesIn == 0 )
+  {
+    return( true );
+  }
+
+  pyramid.decimate( 0, numOfSamplesIn, column, numOfColumns );
+
+  tested++;
+  for( WORD c = 0; c < numOfColumns; c++ )
+  {
+    if( column[c].min < lower[c] || column[c].max > upper[c] )
+    {
+      failed++;
+      failedColumn = c;
+      return( false );
+    }
+  }
+  return( true );
+}
+
+//-------------------------------------------------------------------
+void Mask::resetCounters( void )
+{
+  tested       = 0;
+  failed       = 0;
+  failedColumn = 0;
+}
+
+//-------------------------------------------------------------------
+void Mask::draw( ScreenGraphic            &screen,
+                 const Trace::Window      &window,
+                 const Trace::Calibration &cal,
+                 WORD                      color ) const
+{
+  if( !valid )
+  {
+    return;
+  }
+
+  Trace::Scale scale( window, cal );
+
+  WORD n = ( numOfColumns < window.width ) ? numOfColumns : window.width;
+
+  for( WORD c = 1; c < n; c++ )
+  {
+    WORD x = window.x + c;
+
+    screen.drawLine( x - 1, scale.toY( upper[c-1] ), x, scale.toY( upper[c] ), 1, color );
+    screen.drawLine( x - 1, scale.toY( lower[c-1] ), x, scale.toY( lower[c] ), 1, color );
+  }
+}
+
+//-------------------------------------------------------------------
+void Mask::expand( void )
+{
+  // a column gets the loosest limits of all points it touches
+  for( WORD c = 0; c < numOfColumns; c++ )
+  {
+    WORD first = (DWORD)c       * NUM_OF_POINTS / numOfColumns;
+    WORD last  = ((DWORD)(c + 1) * NUM_OF_POINTS - 1) / numOfColumns;
+
+    lower[c] = 0xFFFF;
+    upper[c] = 0;
+    for( WORD i = first; i <= last && i < NUM_OF_POINTS; i++ )
+    {
+      if( point[i].min < lower[c] ) lower[c] = point[i].min;
+      if( point[i].max > upper[c] ) upper[c] = point[i].max;
+    }
+  }
+}
+
+//-------------------------------------------------------------------
+void Mask::store( void )
+{
+  mem.unlock();
+
+  if( mem.isFlash() )
+  {
+    mem.erase();
+  }
+
+  mem.write( addr,     MAGIC );
+  mem.write( addr + 2, numOfSamples & 0xFF );
+  mem.write( addr + 3, numOfSamples >> 8   );
+
+  BYTE checksum = 0;
+  for( WORD i = 0; i < NUM_OF_POINTS; i++ )
+  {
+    // round outwards, so the stored mask is never tighter
+    BYTE lo = point[i].min >> 8;
+    BYTE hi = point[i].max >> 8;
+
+    checksum ^= lo ^ hi;
+
+    mem.write( addr + HEADER_SIZE + 2*i,     lo );
+    mem.write( addr + HEADER_SIZE + 2*i + 1, hi );
+  }
+  mem.write( addr + 1, checksum );
+
+  mem.lock();
+}
+
+//EOF
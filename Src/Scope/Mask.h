@@ -0,0 +1,163 @@
+//*******************************************************************
+/*!
+\file   Mask.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Pass/fail test of captures against an envelope mask
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_MASK_H
+#define _SCOPE_MASK_H
+
+//*******************************************************************
+#include "Trace.h"
+#include "Pyramid.h"
+
+//*******************************************************************
+/*!
+\class Mask
+
+\brief Upper and lower limit of every column of a capture
+
+The mask is created from a reference capture, widened by a vertical
+tolerance and by some points in time, or loaded from a Memory object.
+It is kept as NUM_OF_POINTS min/max pairs with 8 bit resolution
+(rounded outwards) and expanded once into limit arrays with one entry
+per column. A test only decimates the capture into these columns (see
+Pyramid) and compares min/max with the limits:
+\code
+  pyramid.build( sample, numOfSamples );
+  if( !mask.test( pyramid, numOfSamples ) )
+  {
+    // failed at column mask.getFailedColumn()
+  }
+\endcode
+
+Memory layout (MEMORY_SIZE byte):
+\code
+  0    : MAGIC
+  1    : checksum (xor of all points)
+  2..3 : numOfSamples
+  4..  : NUM_OF_POINTS x (lower,upper), upper byte of raw codes
+\endcode
+On flash memory the mask needs a Memory object of its own, since it
+is erased as a whole.
+*/
+class Mask
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      NUM_OF_POINTS = 200,
+      HEADER_SIZE   = 4,
+      MEMORY_SIZE   = HEADER_SIZE + 2*NUM_OF_POINTS //!< Required memory [byte]
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a mask and load it from memory
+        \param mem          Non-volatile memory
+        \param addr         Start address of the mask in mem
+        \param numOfColumns Number of columns of a test
+    */
+    Mask( Memory &mem, DWORD addr, WORD numOfColumns );
+
+    //---------------------------------------------------------------
+    /*! Reload the mask from memory
+        \return true, if a valid mask was found
+    */
+    bool load( void );
+
+    //---------------------------------------------------------------
+    /*! Create the mask from a reference capture and write it to memory
+        \param pyramid      Pyramid of the reference capture
+        \param numOfSamples Number of samples
+        \param tolerance    Vertical tolerance [code]
+        \param timeTolerance Horizontal tolerance [points]
+    */
+    void create( const Pyramid &pyramid,
+                 WORD           numOfSamples,
+                 WORD           tolerance,
+                 BYTE           timeTolerance );
+
+    //---------------------------------------------------------------
+    bool isValid( void ) const
+    {
+      return( valid );
+    }
+
+    //---------------------------------------------------------------
+    /*! Test a capture and count the result
+        \param pyramid      Pyramid of the capture
+        \param numOfSamples Number of samples, as the reference
+        \return true, if the capture is within the mask
+    */
+    bool test( const Pyramid &pyramid, WORD numOfSamples );
+
+    //---------------------------------------------------------------
+    DWORD getTested( void ) const
+    {
+      return( tested );
+    }
+
+    //---------------------------------------------------------------
+    DWORD getFailed( void ) const
+    {
+      return( failed );
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the first column violating the mask in the last test
+    */
+    WORD getFailedColumn( void ) const
+    {
+      return( failedColumn );
+    }
+
+    //---------------------------------------------------------------
+    /*! Reset the counters
+    */
+    void resetCounters( void );
+
+    //---------------------------------------------------------------
+    /*! Draw the limits, one column per pixel
+        \param screen Target screen
+        \param window Target window, its width should be numOfColumns
+        \param cal    Calibration of the captures
+        \param color  Color
+    */
+    void draw( ScreenGraphic            &screen,
+               const Trace::Window      &window,
+               const Trace::Calibration &cal,
+               WORD                      color ) const;
+
+  private:
+    //---------------------------------------------------------------
+    void expand( void );
+    void store( void );
+
+  private:
+    //---------------------------------------------------------------
+    Memory        &mem;
+    DWORD          addr;
+
+    bool           valid;
+    WORD           numOfSamples;
+    Trace::Column  point[NUM_OF_POINTS]; // lower in min, upper in max
+
+    WORD           numOfColumns;
+    WORD          *lower;                // limits per column
+    WORD          *upper;
+    Trace::Column *column;               // decimated capture
+
+    DWORD          tested;
+    DWORD          failed;
+    WORD           failedColumn;
+
+    static const BYTE MAGIC = 0x5A;
+
+}; //Mask
+
+#endif
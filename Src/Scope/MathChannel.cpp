@@ -0,0 +1,177 @@
+//*******************************************************************
+/*!
+\file   MathChannel.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Trace derived from channel A and B
+*/
+
+//*******************************************************************
+#include "MathChannel.h"
+
+//*******************************************************************
+//
+// MathChannel
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+MathChannel::MathChannel( const Trace::Calibration &calIn,
+                          WORD                      samplePeriodIn,
+                          WORD                      maxSamplesIn )
+{
+  cal          = calIn;
+  samplePeriod = samplePeriodIn;
+  maxSamples   = maxSamplesIn;
+  result       = new WORD[ maxSamples ];
+  shift        = 0;
+
+  // code of 0 mV, i.e. offset + zero * fullScale / 0x10000 = 0
+  int z = ( cal.fullScale > 0 ) ? ( -(int)cal.offset * 0x10000 + cal.fullScale/2 ) / cal.fullScale : 0;
+  zero  = ( z < 0 ) ? 0 : ( z > 0xFFFF ) ? 0xFFFF : z;
+
+  setOperation( ADD );
+}
+
+//-------------------------------------------------------------------
+void MathChannel::setOperation( BYTE operationIn )
+{
+  operation = ( operationIn < NUM_OF_OPERATIONS ) ? operationIn : (BYTE)ADD;
+  range     = 0;
+  isValid   = false;
+}
+
+//-------------------------------------------------------------------
+const WORD *MathChannel::get( const volatile WORD *a,
+                              const volatile WORD *b,
+                              WORD                 numOfSamples )
+{
+  if( !isValid )
+  {
+    compute( a, b, ( numOfSamples < maxSamples ) ? numOfSamples : maxSamples );
+    isValid = true;
+  }
+  return( result );
+}
+
+//-------------------------------------------------------------------
+const char *MathChannel::getUnit( void ) const
+{
+  static const char *unit[NUM_OF_OPERATIONS] =
+  {
+    "V", "V", "V*V", "Vms", "V/ms"
+  };
+  return( unit[operation] );
+}
+
+//-------------------------------------------------------------------
+const char *MathChannel::getName( BYTE op )
+{
+  static const char *name[NUM_OF_OPERATIONS] =
+  {
+    "A+B", "A-B", "A*B", "int(A)", "dA/dt"
+  };
+  return( ( op < NUM_OF_OPERATIONS ) ? name[op] : "" );
+}
+
+//-------------------------------------------------------------------
+void MathChannel::compute( const volatile WORD *a,
+                           const volatile WORD *b,
+                           WORD                 n )
+{
+  // one code of the channels [uV]: fullScale [mV] / 0x10000 * 1000
+  // the result q is a signed 16 bit value, stored as q + 0x8000
+  switch( operation )
+  {
+    case ADD:
+    case SUBTRACT:
+    {
+      // q = A/2 +- B/2, two samples per dual instruction
+      // q = 32768 is 2*32768 codes = fullScale
+      range = cal.fullScale;
+
+      WORD i = 0;
+      for( ; i + 1 < n; i += 2 )
+      {
+        DWORD x = Dsp::pack( ( (int)a[i] - zero ) >> 1, ( (int)a[i+1] - zero ) >> 1 );
+        DWORD y = Dsp::pack( ( (int)b[i] - zero ) >> 1, ( (int)b[i+1] - zero ) >> 1 );
+        DWORD q = ( operation == ADD ) ? Dsp::add2( x, y ) : Dsp::sub2( x, y );
+
+        result[i]   = (WORD)q           ^ 0x8000;
+        result[i+1] = (WORD)( q >> 16 ) ^ 0x8000;
+      }
+      for( ; i < n; i++ )
+      {
+        int x = ( (int)a[i] - zero ) >> 1;
+        int y = ( (int)b[i] - zero ) >> 1;
+
+        result[i] = (WORD)Dsp::sat16( ( operation == ADD ) ? x + y : x - y ) ^ 0x8000;
+      }
+      break;
+    }
+
+    case MULTIPLY:
+    {
+      // q = (A/2 * B/2) >> 14, i.e. A*B >> 16
+      // q = 32768 is 2^31 codes^2 = fullScale^2/2 [mV^2]
+      range = (DWORD)cal.fullScale * cal.fullScale / 2000;
+
+      for( WORD i = 0; i < n; i++ )
+      {
+        int x = ( (int)a[i] - zero ) >> 1;
+        int y = ( (int)b[i] - zero ) >> 1;
+
+        result[i] = (WORD)Dsp::sat16( ( x * y ) >> 14 ) ^ 0x8000;
+      }
+      break;
+    }
+
+    case INTEGRAL:
+    {
+      // running sum of A, scaled to the largest magnitude of the
+      // capture (first pass), so the full height is used
+      int sum = 0;
+      int max = 0;
+      for( WORD i = 0; i < n; i++ )
+      {
+        sum += (int)a[i] - zero;
+        if( sum >  max ) max =  sum;
+        if( sum < -max ) max = -sum;
+      }
+      shift = 0;
+      while( ( max >> shift ) > 32767 )
+      {
+        shift++;
+      }
+
+      // q = 32768 is 2^shift * 32768 codes * samples
+      range = ( ( (DWORD)cal.fullScale * samplePeriod ) >> 1 << shift ) / 1000;
+
+      sum = 0;
+      for( WORD i = 0; i < n; i++ )
+      {
+        sum      += (int)a[i] - zero;
+        result[i] = (WORD)Dsp::sat16( sum >> shift ) ^ 0x8000;
+      }
+      break;
+    }
+
+    case DIFFERENCE:
+    {
+      // q = A[i] - A[i-1] [codes/sample]
+      // q = 32768 is fullScale/2 per sample period [mV/ms]
+      range = (DWORD)cal.fullScale * 500 / samplePeriod;
+
+      if( n > 0 )
+      {
+        result[0] = 0x8000;
+      }
+      for( WORD i = 1; i < n; i++ )
+      {
+        result[i] = (WORD)Dsp::sat16( (int)a[i] - (int)a[i-1] ) ^ 0x8000;
+      }
+      break;
+    }
+  }
+}
+
+//EOF
@@ -0,0 +1,129 @@
+//*******************************************************************
+/*!
+\file   MathChannel.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Trace derived from channel A and B
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_MATH_CHANNEL_H
+#define _SCOPE_MATH_CHANNEL_H
+
+//*******************************************************************
+#include "Trace.h"
+#include "Dsp.h"
+
+//*******************************************************************
+/*!
+\class MathChannel
+
+\brief A+B, A-B, A*B, integral and first difference of A
+
+The operations work on the raw codes of both channels, centered at
+the code of 0 V, with integer arithmetic and saturation. The result
+is a capture of raw codes with its own scale: code 0x8000 is 0,
+0x0000 and 0xFFFF are -getRange() and +getRange(). So it can be
+drawn like any other capture, e.g. with
+\code
+  Trace::Calibration cal = { -32768, 0xFFFF };
+\endcode
+and a window from mVBottom = -32768 to mVTop = 32767.
+
+The result is computed lazily: invalidate() marks a new capture, the
+next get() computes it once.
+*/
+class MathChannel
+{
+  public:
+    //---------------------------------------------------------------
+    enum Operation
+    {
+      ADD = 0,
+      SUBTRACT,
+      MULTIPLY,
+      INTEGRAL,
+      DIFFERENCE,
+      NUM_OF_OPERATIONS
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a math channel
+        \param cal           Calibration of channel A and B
+        \param samplePeriod  Sample period [us]
+        \param maxSamples    Max. number of samples of a capture
+    */
+    MathChannel( const Trace::Calibration &cal,
+                 WORD                      samplePeriod,
+                 WORD                      maxSamples );
+
+    //---------------------------------------------------------------
+    /*! Select the operation
+    */
+    void setOperation( BYTE operation );
+
+    //---------------------------------------------------------------
+    BYTE getOperation( void ) const
+    {
+      return( operation );
+    }
+
+    //---------------------------------------------------------------
+    /*! Mark the result as outdated, e.g. after a new capture
+    */
+    void invalidate( void )
+    {
+      isValid = false;
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the result, computed only if outdated
+        \param a            Raw samples of channel A
+        \param b            Raw samples of channel B
+        \param numOfSamples Number of samples, up to maxSamples
+        \return Raw codes of the result
+    */
+    const WORD *get( const volatile WORD *a,
+                     const volatile WORD *b,
+                     WORD                 numOfSamples );
+
+    //---------------------------------------------------------------
+    /*! Get the value of code 0xFFFF in 1/1000 of getUnit()
+    */
+    DWORD getRange( void ) const
+    {
+      return( range );
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the unit of the result
+    */
+    const char *getUnit( void ) const;
+
+    //---------------------------------------------------------------
+    /*! Get the name of an operation
+    */
+    static const char *getName( BYTE operation );
+
+  private:
+    //---------------------------------------------------------------
+    void compute( const volatile WORD *a,
+                  const volatile WORD *b,
+                  WORD                 numOfSamples );
+
+  private:
+    //---------------------------------------------------------------
+    Trace::Calibration cal;
+    WORD               samplePeriod;
+    WORD               maxSamples;
+    WORD               zero;       // code of 0 mV
+    BYTE               operation;
+    BYTE               shift;      // scaling of the integral
+    DWORD              range;
+    bool               isValid;
+    WORD              *result;
+
+}; //MathChannel
+
+#endif
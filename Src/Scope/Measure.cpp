@@ -0,0 +1,238 @@
+//*******************************************************************
+/*!
+\file   Measure.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Automatic measurements of a capture in one pass
+*/
+
+//*******************************************************************
+#include <math.h>
+
+#include "Measure.h"
+
+//*******************************************************************
+//
+// Measure
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Measure::Measure( const Trace::Calibration &calIn, WORD samplePeriodIn )
+{
+  cal          = calIn;
+  samplePeriod = samplePeriodIn;
+
+  result.minimum    = 0;
+  result.maximum    = 0;
+  result.peakToPeak = 0;
+  result.mean       = 0;
+  result.rms        = 0;
+  result.period     = 0;
+  result.frequency  = 0;
+  result.duty       = 0;
+  result.rise       = 0;
+  result.fall       = 0;
+}
+
+//-------------------------------------------------------------------
+void Measure::update( const volatile WORD  *sample,
+                      WORD                  numOfSamples,
+                      const Trace::Column  &range )
+{
+  if( numOfSamples == 0 )
+  {
+    return;
+  }
+
+  // reference levels [code]
+  int  swing  = range.max - range.min;
+  int  lo     = range.min + swing / 10;
+  int  mid    = range.min + swing / 2;
+  int  hi     = range.max - swing / 10;
+  bool timing = ( swing >= MIN_SWING );
+
+  // voltage accumulators
+  DWORD              sum   = 0;
+  unsigned long long sumSq = 0;
+
+  // edge state, times in 1/FRAC sample
+  bool  isHigh    = ( sample[0] > mid );
+  bool  isStarted = false; // a 10% or 90% crossing of the actual edge was seen
+  DWORD tStart    = 0;     // 10% (rising) or 90% (falling) crossing
+  DWORD tMid      = 0;     // 50% crossing of the actual edge
+  DWORD tRising   = 0;     // 50% crossing of the last rising edge
+
+  DWORD tFirst       = 0;  // first rising edge
+  DWORD tLast        = 0;  // last rising edge
+  WORD  numOfPeriods = 0;  // number of rising edges
+  DWORD high         = 0;  // high time since the first rising edge
+  DWORD highAtLast   = 0;  // high time up to the last rising edge
+
+  DWORD riseSum   = 0;
+  WORD  numOfRise = 0;
+  DWORD fallSum   = 0;
+  WORD  numOfFall = 0;
+
+  int prev = sample[0];
+
+  for( WORD i = 0; i < numOfSamples; i++ )
+  {
+    int c = sample[i];
+
+    sum   += c;
+    sumSq += (DWORD)c * c;
+
+    if( !timing || i == 0 )
+    {
+      prev = c;
+      continue;
+    }
+
+    if( !isHigh )
+    {
+      if( prev < lo && c >= lo )
+      {
+        tStart    = cross( i, prev, c, lo );
+        isStarted = true;
+      }
+      if( prev < mid && c >= mid )
+      {
+        tMid = cross( i, prev, c, mid );
+      }
+      if( c >= hi ) // rising edge complete
+      {
+        if( isStarted )
+        {
+          riseSum += cross( i, prev, c, hi ) - tStart;
+          numOfRise++;
+        }
+        if( numOfPeriods == 0 )
+        {
+          tFirst = tMid;
+        }
+        tLast      = tMid;
+        tRising    = tMid;
+        highAtLast = high;
+        numOfPeriods++;
+
+        isHigh    = true;
+        isStarted = false;
+      }
+    }
+    else
+    {
+      if( prev > hi && c <= hi )
+      {
+        tStart    = cross( i, prev, c, hi );
+        isStarted = true;
+      }
+      if( prev > mid && c <= mid )
+      {
+        tMid = cross( i, prev, c, mid );
+      }
+      if( c <= lo ) // falling edge complete
+      {
+        if( isStarted )
+        {
+          fallSum += cross( i, prev, c, lo ) - tStart;
+          numOfFall++;
+        }
+        if( numOfPeriods > 0 )
+        {
+          high += tMid - tRising;
+        }
+        isHigh    = false;
+        isStarted = false;
+      }
+    }
+    prev = c;
+  }
+
+  // conversion into mV with the calibration
+  double k  = cal.fullScale / 65536.0;
+  double m1 = (double)sum   / numOfSamples;
+  double m2 = (double)sumSq / numOfSamples;
+  double ms = (double)cal.offset * cal.offset + 2.0 * cal.offset * k * m1 + k * k * m2;
+
+  result.minimum    = cal.toMilliVolt( range.min );
+  result.maximum    = cal.toMilliVolt( range.max );
+  result.peakToPeak = result.maximum - result.minimum;
+  result.mean       = (int)lround( cal.offset + k * m1 );
+  result.rms        = (int)lround( sqrt( ( ms > 0.0 ) ? ms : 0.0 ) );
+
+  result.period    = 0;
+  result.frequency = 0;
+  result.duty      = 0;
+  if( numOfPeriods >= 2 && tLast > tFirst )
+  {
+    DWORD span = tLast - tFirst;
+
+    result.period    = toNanoSec( span, numOfPeriods - 1 );
+    result.frequency = (DWORD)( (unsigned long long)( numOfPeriods - 1 ) * FRAC * 1000000000ULL
+                              / ( (unsigned long long)span * samplePeriod ) );
+    result.duty      = (WORD)( (unsigned long long)highAtLast * 1000 / span );
+  }
+  result.rise = ( numOfRise > 0 ) ? toNanoSec( riseSum, numOfRise ) : 0;
+  result.fall = ( numOfFall > 0 ) ? toNanoSec( fallSum, numOfFall ) : 0;
+}
+
+//-------------------------------------------------------------------
+void Measure::drawReadout( ScreenGraphic &screen, WORD x, WORD y ) const
+{
+  drawVolt( screen, x,       y, "min=",  result.minimum );
+  drawVolt( screen, x + 160, y, "max=",  result.maximum );
+  y += LINE_HEIGHT;
+
+  drawVolt( screen, x,       y, "pp=",   result.peakToPeak );
+  drawVolt( screen, x + 160, y, "mean=", result.mean );
+  y += LINE_HEIGHT;
+
+  drawVolt( screen, x,       y, "rms=",  result.rms );
+  y += LINE_HEIGHT;
+
+  if( result.period > 0 )
+  {
+    // f with one decimal [Hz], T [us], duty [%]
+    screen.drawText( x, y, "f=%d.%dHz T=%dus duty=%d.%d%s   ",
+                     (int)(result.frequency / 1000), (int)((result.frequency / 100) % 10),
+                     (int)(result.period / 1000),
+                     result.duty / 10, result.duty % 10, "%" );
+  }
+  else
+  {
+    screen.drawText( x, y, "f=--- T=--- duty=---              " );
+  }
+  y += LINE_HEIGHT;
+
+  screen.drawText( x, y, "rise=%dus fall=%dus      ",
+                   (int)(result.rise / 1000), (int)(result.fall / 1000) );
+}
+
+//-------------------------------------------------------------------
+DWORD Measure::cross( DWORD i, int a, int b, int level )
+{
+  // a < level <= b or a > level >= b, so b != a
+  return( ( i - 1 ) * FRAC + ( level - a ) * FRAC / ( b - a ) );
+}
+
+//-------------------------------------------------------------------
+DWORD Measure::toNanoSec( DWORD t, DWORD divisor ) const
+{
+  return( (DWORD)( (unsigned long long)t * samplePeriod * 1000 / ( (DWORD)FRAC * divisor ) ) );
+}
+
+//-------------------------------------------------------------------
+void Measure::drawVolt( ScreenGraphic &screen,
+                        WORD           x,
+                        WORD           y,
+                        const char    *label,
+                        int            mV )
+{
+  screen.drawText( x, y, "%s%s%d.%03dV  ",
+                   label,
+                   ( mV < 0 ) ? "-" : "",
+                   ( mV < 0 ? -mV : mV ) / 1000,
+                   ( mV < 0 ? -mV : mV ) % 1000 );
+}
+
+//EOF
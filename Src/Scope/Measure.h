@@ -0,0 +1,130 @@
+//*******************************************************************
+/*!
+\file   Measure.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Automatic measurements of a capture in one pass
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_MEASURE_H
+#define _SCOPE_MEASURE_H
+
+//*******************************************************************
+#include "Trace.h"
+
+//*******************************************************************
+/*!
+\class Measure
+
+\brief Voltage and timing measurements of a capture
+
+All measurements are taken in one pass over the raw codes with integer
+accumulators. The calibration is applied once at the end, so adding a
+measurement hardly costs anything.
+
+The reference levels (10%, 50%, 90%) are taken from the min/max of
+the capture, which is known before the pass, e.g. from the Pyramid:
+\code
+  Trace::Column range;
+
+  pyramid.decimate( 0, numOfSamples, &range, 1 );
+  measure.update( sample, numOfSamples, range );
+  measure.drawReadout( screen, x, y );
+\endcode
+An edge is detected, if the signal crosses the 10% and the 90% level
+(hysteresis). Its time is the interpolated crossing of the 50% level.
+Period and duty cycle are averaged from the first to the last rising
+edge, rise and fall time (10% ... 90%) over all complete edges.
+*/
+class Measure
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Measured values, a timing value of 0 was not measurable
+    */
+    class Result
+    {
+      public:
+        int   minimum;    //!< [mV]
+        int   maximum;    //!< [mV]
+        int   peakToPeak; //!< [mV]
+        int   mean;       //!< [mV]
+        int   rms;        //!< True RMS, DC included [mV]
+        DWORD period;     //!< [ns]
+        DWORD frequency;  //!< [mHz]
+        WORD  duty;       //!< High time per period [0.1 %]
+        DWORD rise;       //!< 10% ... 90% [ns]
+        DWORD fall;       //!< 90% ... 10% [ns]
+    };
+
+    //---------------------------------------------------------------
+    enum
+    {
+      MIN_SWING   = 0x200, //!< Min. peak to peak [code] for timing measurements
+      LINE_HEIGHT = 20     //!< Readout line height [px], fits Font_10x20
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a measurement engine
+        \param cal          Calibration of the codes
+        \param samplePeriod Sample period [us]
+    */
+    Measure( const Trace::Calibration &cal, WORD samplePeriod );
+
+    //---------------------------------------------------------------
+    /*! Measure a capture
+        \param sample       Raw samples
+        \param numOfSamples Number of samples
+        \param range        Min/max code of the samples
+    */
+    void update( const volatile WORD  *sample,
+                 WORD                  numOfSamples,
+                 const Trace::Column  &range );
+
+    //---------------------------------------------------------------
+    /*! Get the result of the last update
+    */
+    const Result &get( void ) const
+    {
+      return( result );
+    }
+
+    //---------------------------------------------------------------
+    /*! Print the result, 5 lines of LINE_HEIGHT
+    */
+    void drawReadout( ScreenGraphic &screen, WORD x, WORD y ) const;
+
+  private:
+    //---------------------------------------------------------------
+    // time of the crossing of a level between sample i-1 (a) and
+    // sample i (b) [1/FRAC sample]
+    static DWORD cross( DWORD i, int a, int b, int level );
+
+    //---------------------------------------------------------------
+    // time [1/FRAC sample] to ns
+    DWORD toNanoSec( DWORD t, DWORD divisor ) const;
+
+    //---------------------------------------------------------------
+    static void drawVolt( ScreenGraphic &screen,
+                          WORD           x,
+                          WORD           y,
+                          const char    *label,
+                          int            mV );
+
+  private:
+    //---------------------------------------------------------------
+    enum
+    {
+      FRAC = 256 // sub-sample resolution of the crossings
+    };
+
+    //---------------------------------------------------------------
+    Trace::Calibration cal;
+    WORD               samplePeriod;
+    Result             result;
+
+}; //Measure
+
+#endif
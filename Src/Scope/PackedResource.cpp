@@ -0,0 +1,156 @@
+//*******************************************************************
+/*!
+\file   PackedResource.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Run length coded font and bitmap resources
+*/
+
+//*******************************************************************
+#include "PackedResource.h"
+
+//*******************************************************************
+//
+// PackedResource::Reader
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+PackedResource::Reader::Reader( const BYTE *data )
+{
+  unitSize  = data[3];
+  remaining = getSize( data ) / unitSize;
+  ptr       = data + HEADER_SIZE;
+  count     = 0;
+  isRun     = false;
+  runUnit   = 0;
+}
+
+//-------------------------------------------------------------------
+WORD PackedResource::Reader::get( WORD &unit, WORD maxCount )
+{
+  if( count == 0 )
+  {
+    if( remaining == 0 )
+    {
+      return( 0 );
+    }
+    BYTE token = *ptr++;
+    if( token & 0x80 )
+    {
+      isRun   = true;
+      count   = (token & 0x7F) + 2;
+      runUnit = readUnit();
+    }
+    else
+    {
+      isRun = false;
+      count = token + 1;
+    }
+    // a corrupt token must not read beyond the resource
+    if( count > remaining )
+    {
+      count = remaining;
+    }
+  }
+
+  if( !isRun )
+  {
+    maxCount = 1;
+  }
+  else if( maxCount > count )
+  {
+    maxCount = count;
+  }
+
+  unit       = isRun ? runUnit : readUnit();
+  count     -= maxCount;
+  remaining -= maxCount;
+
+  return( maxCount );
+}
+
+//-------------------------------------------------------------------
+WORD PackedResource::Reader::get( void )
+{
+  WORD unit = 0;
+
+  get( unit, 1 );
+  return( unit );
+}
+
+//-------------------------------------------------------------------
+WORD PackedResource::Reader::readUnit( void )
+{
+  WORD unit = *ptr++;
+
+  if( unitSize == 2 )
+  {
+    unit |= (WORD)(*ptr++) << 8;
+  }
+  return( unit );
+}
+
+//*******************************************************************
+//
+// PackedResource
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+bool PackedResource::isPacked( const BYTE *data )
+{
+  return(    data
+          && data[0] == 'R'
+          && data[1] == 'L'
+          && data[2] == 'E'
+          && ( data[3] == 1 || data[3] == 2 ) );
+}
+
+//-------------------------------------------------------------------
+DWORD PackedResource::getSize( const BYTE *data )
+{
+  return(         data[4]
+          | (DWORD)data[5] <<  8
+          | (DWORD)data[6] << 16
+          | (DWORD)data[7] << 24 );
+}
+
+//-------------------------------------------------------------------
+DWORD PackedResource::unpack( const BYTE *data, BYTE *dst, DWORD size )
+{
+  Reader reader( data );
+  BYTE   unitSize = data[3];
+  DWORD  pos      = 0;
+  WORD   unit;
+  WORD   n;
+
+  while( (n = reader.get( unit )) > 0 )
+  {
+    for( ; n > 0 && pos + unitSize <= size; n-- )
+    {
+      dst[pos++] = unit & 0xFF;
+      if( unitSize == 2 )
+      {
+        dst[pos++] = unit >> 8;
+      }
+    }
+  }
+  return( pos );
+}
+
+//-------------------------------------------------------------------
+const BYTE *PackedResource::load( const BYTE *data )
+{
+  if( !isPacked( data ) )
+  {
+    return( data );
+  }
+
+  DWORD size = getSize( data );
+  BYTE *buf  = new BYTE[ size ];
+
+  unpack( data, buf, size );
+
+  return( buf );
+}
+
+//EOF
@@ -0,0 +1,122 @@
+//*******************************************************************
+/*!
+\file   PackedResource.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Run length coded font and bitmap resources
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_PACKED_RESOURCE_H
+#define _SCOPE_PACKED_RESOURCE_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+
+using namespace EmbSysLib::Hw;
+using namespace EmbSysLib::Dev;
+
+//*******************************************************************
+/*!
+\class PackedResource
+
+\brief Decoder for fonts and bitmaps packed by the Pack tool
+
+A packed resource starts with a small header followed by run length
+coded units (bytes for fonts, 16 bit pixels for bitmaps):
+\code
+  Header: BYTE 'R','L','E', BYTE unitSize (1 or 2),
+          DWORD size of the unpacked data (little endian)
+  Token:  bit 7 set: (token & 0x7F) + 2 times the following unit
+          else     :  token + 1 literal units follow
+\endcode
+Unpacked data is accepted everywhere as well, so a resource can be
+switched between packed and unpacked without touching the code. A
+packed resource needs a copy in RAM, so large bitmaps are better kept
+unpacked and drawn straight from the image or flash.
+
+\see Src/Resource/Pack/Pack.cpp
+*/
+class PackedResource
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      HEADER_SIZE = 8,
+      MAX_RUN     = 0x7F + 2,
+      MAX_LITERAL = 0x7F + 1
+    };
+
+    //---------------------------------------------------------------
+    /*! Sequential reader of the units of a packed resource
+    */
+    class Reader
+    {
+      public:
+        //-----------------------------------------------------------
+        /*! Start reading at the first unit
+            \param data Packed resource
+        */
+        Reader( const BYTE *data );
+
+        //-----------------------------------------------------------
+        /*! Get the next run of equal units
+            \param unit     Value of the units
+            \param maxCount Maximum number of units to be taken
+            \return Number of units taken (at least 1), 0 at the end
+        */
+        WORD get( WORD &unit, WORD maxCount = 0xFFFF );
+
+        //-----------------------------------------------------------
+        /*! Get the next single unit
+        */
+        WORD get( void );
+
+      private:
+        //-----------------------------------------------------------
+        WORD readUnit( void );
+
+      private:
+        //-----------------------------------------------------------
+        const BYTE *ptr;
+        BYTE        unitSize;
+        DWORD       remaining; // units not decoded yet
+        WORD        count;     // units left in the actual token
+        bool        isRun;
+        WORD        runUnit;
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Check, if data is a packed resource
+    */
+    static bool isPacked( const BYTE *data );
+
+    //---------------------------------------------------------------
+    /*! Get the size of the unpacked data [byte]
+    */
+    static DWORD getSize( const BYTE *data );
+
+    //---------------------------------------------------------------
+    /*! Unpack into a buffer
+        \param data Packed resource
+        \param dst  Destination
+        \param size Size of the destination [byte]
+        \return Number of bytes written
+    */
+    static DWORD unpack( const BYTE *data, BYTE *dst, DWORD size );
+
+    //---------------------------------------------------------------
+    /*! Get a resource in the format expected by Font and Bitmap.
+        A packed resource is unpacked once into RAM, unpacked data is
+        returned unchanged.
+        \code
+          Font font( PackedResource::load( MemoryImage( image, "Font_8x12" ).getPtr() ) );
+        \endcode
+    */
+    static const BYTE *load( const BYTE *data );
+
+}; //PackedResource
+
+#endif
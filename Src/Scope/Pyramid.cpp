@@ -0,0 +1,144 @@
+//*******************************************************************
+/*!
+\file   Pyramid.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Min/max decimation pyramid of a capture
+*/
+
+//*******************************************************************
+#include "Pyramid.h"
+
+//*******************************************************************
+//
+// Pyramid
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Pyramid::Pyramid( Trace::Column *storageIn, DWORD storageSizeIn )
+{
+  storage      = storageIn;
+  storageSize  = storageSizeIn;
+  sample       = 0;
+  numOfSamples = 0;
+  numOfLevels  = 1;
+}
+
+//-------------------------------------------------------------------
+void Pyramid::build( const volatile WORD *sampleIn, WORD numOfSamplesIn )
+{
+  sample       = sampleIn;
+  numOfSamples = numOfSamplesIn;
+  numOfLevels  = 1;
+
+  DWORD used = 0;
+  DWORD size = numOfSamples / 2;
+
+  // level 1 from pairs of samples
+  if( size > 0 && used + size <= storageSize )
+  {
+    level    [1] = &storage[used];
+    levelSize[1] = size;
+    for( DWORD i = 0; i < size; i++ )
+    {
+      WORD a = sample[2*i];
+      WORD b = sample[2*i + 1];
+
+      level[1][i].min = ( a < b ) ? a : b;
+      level[1][i].max = ( a < b ) ? b : a;
+    }
+    used       += size;
+    numOfLevels = 2;
+  }
+
+  // every further level from pairs of the level below
+  while( numOfLevels < MAX_LEVELS )
+  {
+    const Trace::Column *below = level    [numOfLevels - 1];
+    DWORD                size  = levelSize[numOfLevels - 1] / 2;
+
+    if( size == 0 || used + size > storageSize )
+    {
+      break;
+    }
+
+    Trace::Column *col = &storage[used];
+    for( DWORD i = 0; i < size; i++ )
+    {
+      const Trace::Column &a = below[2*i];
+      const Trace::Column &b = below[2*i + 1];
+
+      col[i].min = ( a.min < b.min ) ? a.min : b.min;
+      col[i].max = ( a.max > b.max ) ? a.max : b.max;
+    }
+    level    [numOfLevels] = col;
+    levelSize[numOfLevels] = size;
+    used += size;
+    numOfLevels++;
+  }
+}
+
+//-------------------------------------------------------------------
+void Pyramid::decimate( DWORD          first,
+                        DWORD          count,
+                        Trace::Column *column,
+                        WORD           numOfColumns ) const
+{
+  if( numOfSamples == 0 || numOfColumns == 0 )
+  {
+    return;
+  }
+  if( first >= numOfSamples )
+  {
+    first = numOfSamples - 1;
+  }
+  if( count == 0 || first + count > numOfSamples )
+  {
+    count = numOfSamples - first;
+  }
+
+  for( WORD c = 0; c < numOfColumns; c++ )
+  {
+    DWORD pos = first + (DWORD) c      * count / numOfColumns;
+    DWORD end = first + (DWORD)(c + 1) * count / numOfColumns;
+
+    if( end <= pos )
+    {
+      end = pos + 1; // less samples than columns
+    }
+
+    WORD min = 0xFFFF;
+    WORD max = 0;
+
+    // cover [pos,end) with the largest aligned blocks
+    while( pos < end )
+    {
+      BYTE k = 0;
+      while(    k + 1 < numOfLevels
+             && ( pos & ((2UL << k) - 1) ) == 0
+             && pos + (2UL << k) <= end )
+      {
+        k++;
+      }
+
+      if( k == 0 )
+      {
+        WORD s = sample[pos];
+        if( s < min ) min = s;
+        if( s > max ) max = s;
+        pos++;
+      }
+      else
+      {
+        const Trace::Column &b = level[k][pos >> k];
+        if( b.min < min ) min = b.min;
+        if( b.max > max ) max = b.max;
+        pos += 1UL << k;
+      }
+    }
+    column[c].min = min;
+    column[c].max = max;
+  }
+}
+
+//EOF
@@ -0,0 +1,91 @@
+//*******************************************************************
+/*!
+\file   Pyramid.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Min/max decimation pyramid of a capture
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_PYRAMID_H
+#define _SCOPE_PYRAMID_H
+
+//*******************************************************************
+#include "Trace.h"
+
+//*******************************************************************
+/*!
+\class Pyramid
+
+\brief Min/max of a capture over blocks of 2, 4, 8, ... samples
+
+The pyramid is built once per capture. Afterwards any sample range can
+be decimated into any number of columns by combining the largest
+aligned blocks, so the cost of a view depends on its number of columns
+and hardly on the number of samples it shows.
+
+Level k holds one Column per 2^k samples, level 0 are the samples
+themselves. All levels together need less storage than the capture.
+*/
+class Pyramid
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      MAX_LEVELS = 16
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a pyramid
+        \param storage     Storage for the levels
+        \param storageSize Number of columns of the storage. Levels,
+                           which do not fit, are omitted.
+    */
+    Pyramid( Trace::Column *storage, DWORD storageSize );
+
+    //---------------------------------------------------------------
+    /*! Build the levels of a capture. The samples are referenced,
+        not copied.
+        \param sample       Raw samples
+        \param numOfSamples Number of samples
+    */
+    void build( const volatile WORD *sample, WORD numOfSamples );
+
+    //---------------------------------------------------------------
+    /*! Decimate a sample range into columns. If the range has less
+        samples than columns, samples are repeated.
+        \param first        Index of the first sample
+        \param count        Number of samples
+        \param column       Destination
+        \param numOfColumns Number of columns
+    */
+    void decimate( DWORD          first,
+                   DWORD          count,
+                   Trace::Column *column,
+                   WORD           numOfColumns ) const;
+
+    //---------------------------------------------------------------
+    /*! Get the number of samples of the actual capture
+    */
+    WORD getNumOfSamples( void ) const
+    {
+      return( numOfSamples );
+    }
+
+  private:
+    //---------------------------------------------------------------
+    Trace::Column           *storage;
+    DWORD                    storageSize;
+
+    const volatile WORD     *sample;
+    WORD                     numOfSamples;
+
+    Trace::Column           *level    [MAX_LEVELS]; // level[0] unused
+    DWORD                    levelSize[MAX_LEVELS];
+    BYTE                     numOfLevels;
+
+}; //Pyramid
+
+#endif
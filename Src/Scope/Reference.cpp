@@ -0,0 +1,189 @@
+//*******************************************************************
+/*!
+\file   Reference.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Reference waveform slots, stored in non-volatile memory
+*/
+
+//*******************************************************************
+#include "Reference.h"
+
+//*******************************************************************
+//
+// Reference
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Reference::Reference( Memory &memIn, DWORD addrIn )
+
+: mem ( memIn  ),
+  addr( addrIn )
+
+{
+  load();
+}
+
+//-------------------------------------------------------------------
+void Reference::load( void )
+{
+  for( BYTE s = 0; s < NUM_OF_SLOTS; s++ )
+  {
+    DWORD a = addr + s*SLOT_SIZE;
+
+    valid[s] = false;
+
+    if( mem.read( a ) != MAGIC )
+    {
+      continue;
+    }
+
+    meta[s].numOfSamples  =        readWord( a + 1 );
+    meta[s].samplePeriod  =        readWord( a + 3 );
+    meta[s].cal.offset    = (short)readWord( a + 5 );
+    meta[s].cal.fullScale =        readWord( a + 7 );
+
+    BYTE checksum = 0;
+    for( WORD i = 0; i < NUM_OF_POINTS; i++ )
+    {
+      BYTE min = mem.read( a + HEADER_SIZE + 2*i     );
+      BYTE max = mem.read( a + HEADER_SIZE + 2*i + 1 );
+
+      checksum ^= min ^ max;
+
+      // restore to the center of the quantization step
+      column[s][i].min = ((WORD)min << 8) | 0x80;
+      column[s][i].max = ((WORD)max << 8) | 0x80;
+    }
+    valid[s] = ( checksum == mem.read( a + 9 ) );
+  }
+}
+
+//-------------------------------------------------------------------
+void Reference::set( BYTE                      slot,
+                     const volatile WORD      *sample,
+                     WORD                      numOfSamples,
+                     WORD                      samplePeriod,
+                     const Trace::Calibration &cal )
+{
+  if( slot >= NUM_OF_SLOTS || numOfSamples == 0 )
+  {
+    return;
+  }
+
+  Trace::decimate( sample, numOfSamples, column[slot], NUM_OF_POINTS );
+
+  // quantize in RAM, too. So a reloaded slot looks exactly the same
+  for( WORD i = 0; i < NUM_OF_POINTS; i++ )
+  {
+    column[slot][i].min = (column[slot][i].min & 0xFF00) | 0x80;
+    column[slot][i].max = (column[slot][i].max & 0xFF00) | 0x80;
+  }
+
+  meta[slot].numOfSamples = numOfSamples;
+  meta[slot].samplePeriod = samplePeriod;
+  meta[slot].cal          = cal;
+  valid[slot]             = true;
+
+  store();
+}
+
+//-------------------------------------------------------------------
+void Reference::clear( BYTE slot )
+{
+  if( slot < NUM_OF_SLOTS )
+  {
+    valid[slot] = false;
+    store();
+  }
+}
+
+//-------------------------------------------------------------------
+void Reference::draw( Trace               &trace,
+                      BYTE                 slot,
+                      const Trace::Window &window,
+                      WORD                 color,
+                      const Trace::Region *clip )
+{
+  if( !isValid( slot ) || window.duration == 0 )
+  {
+    return;
+  }
+
+  // width of the slot relative to the window's time span
+  DWORD duration = (DWORD)meta[slot].numOfSamples * meta[slot].samplePeriod;
+  DWORD width    = (DWORD)window.width * duration / window.duration;
+
+  if( width > window.width )
+  {
+    width = window.width;
+  }
+
+  Trace::Scale scale( window, meta[slot].cal );
+
+  trace.draw( column[slot],
+              NUM_OF_POINTS,
+              window.x,
+              width,
+              scale,
+              Trace::dim( color ),
+              clip );
+}
+
+//-------------------------------------------------------------------
+void Reference::store( void )
+{
+  mem.unlock();
+
+  if( mem.isFlash() )
+  {
+    mem.erase();
+  }
+
+  for( BYTE s = 0; s < NUM_OF_SLOTS; s++ )
+  {
+    DWORD a = addr + s*SLOT_SIZE;
+
+    if( !valid[s] )
+    {
+      mem.write( a, 0xFF ); // invalid magic
+      continue;
+    }
+
+    mem.write( a, MAGIC );
+    writeWord( a + 1,       meta[s].numOfSamples  );
+    writeWord( a + 3,       meta[s].samplePeriod  );
+    writeWord( a + 5, (WORD)meta[s].cal.offset    );
+    writeWord( a + 7,       meta[s].cal.fullScale );
+
+    BYTE checksum = 0;
+    for( WORD i = 0; i < NUM_OF_POINTS; i++ )
+    {
+      BYTE min = column[s][i].min >> 8;
+      BYTE max = column[s][i].max >> 8;
+
+      checksum ^= min ^ max;
+
+      mem.write( a + HEADER_SIZE + 2*i,     min );
+      mem.write( a + HEADER_SIZE + 2*i + 1, max );
+    }
+    mem.write( a + 9, checksum );
+  }
+
+  mem.lock();
+}
+
+//-------------------------------------------------------------------
+void Reference::writeWord( DWORD a, WORD data )
+{
+  mem.write( a,     data & 0xFF );
+  mem.write( a + 1, data >> 8   );
+}
+
+//-------------------------------------------------------------------
+WORD Reference::readWord( DWORD a )
+{
+  return( mem.read( a ) | ((WORD)mem.read( a + 1 ) << 8) );
+}
+
+//EOF
@@ -0,0 +1,140 @@
+//*******************************************************************
+/*!
+\file   Reference.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Reference waveform slots, stored in non-volatile memory
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_REFERENCE_H
+#define _SCOPE_REFERENCE_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+#include "Trace.h"
+
+//*******************************************************************
+/*!
+\class Reference
+
+\brief Reference waveforms (golden captures)
+
+Each slot holds a decimated capture (NUM_OF_POINTS min/max pairs with
+8 bit resolution) together with its calibration and timebase. All slots
+are kept in RAM and are written to or loaded from a Memory object as a
+whole, so flash memory with sector erase is supported, too. Flash is
+erased completely, so it must not be shared with other data.
+
+Memory layout per slot (SLOT_SIZE byte):
+\code
+  0    : MAGIC
+  1..2 : numOfSamples
+  3..4 : samplePeriod [us]
+  5..6 : calibration offset [mV]
+  7..8 : calibration fullScale [mV]
+  9    : checksum (xor of all points)
+  10.. : NUM_OF_POINTS x (min,max), upper byte of raw codes
+\endcode
+*/
+class Reference
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      NUM_OF_SLOTS  = 4,
+      NUM_OF_POINTS = 200,
+      HEADER_SIZE   = 10,
+      SLOT_SIZE     = HEADER_SIZE + 2*NUM_OF_POINTS,
+      MEMORY_SIZE   = NUM_OF_SLOTS * SLOT_SIZE  //!< Required memory [byte]
+    };
+
+    //---------------------------------------------------------------
+    /*! Calibration and timebase of a capture
+    */
+    class Meta
+    {
+      public:
+        WORD               numOfSamples;
+        WORD               samplePeriod; //!< [us]
+        Trace::Calibration cal;
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate the slots and load them from memory
+        \param mem  Non-volatile memory
+        \param addr Start address of the slots in mem
+    */
+    Reference( Memory &mem, DWORD addr = 0 );
+
+    //---------------------------------------------------------------
+    /*! Reload all slots from memory
+    */
+    void load( void );
+
+    //---------------------------------------------------------------
+    /*! Store a capture into a slot and write all slots to memory
+        \param slot         Slot index
+        \param sample       Raw samples
+        \param numOfSamples Number of samples
+        \param samplePeriod Sample period [us]
+        \param cal          Calibration of the samples
+    */
+    void set( BYTE                      slot,
+              const volatile WORD      *sample,
+              WORD                      numOfSamples,
+              WORD                      samplePeriod,
+              const Trace::Calibration &cal );
+
+    //---------------------------------------------------------------
+    /*! Invalidate a slot and write all slots to memory
+    */
+    void clear( BYTE slot );
+
+    //---------------------------------------------------------------
+    /*! Check, if a slot contains a valid capture
+    */
+    bool isValid( BYTE slot )
+    {
+      return( slot < NUM_OF_SLOTS && valid[slot] );
+    }
+
+    //---------------------------------------------------------------
+    /*! Draw a slot as dimmed overlay. The time axis of the slot is
+        scaled to the duration of the window.
+        \param trace  Renderer
+        \param slot   Slot index
+        \param window Target window
+        \param color  Color, which is dimmed before drawing
+        \param clip   If given, only spans touching this region are drawn
+    */
+    void draw( Trace               &trace,
+               BYTE                 slot,
+               const Trace::Window &window,
+               WORD                 color,
+               const Trace::Region *clip = 0 );
+
+  private:
+    //---------------------------------------------------------------
+    void store( void );
+
+    //---------------------------------------------------------------
+    void writeWord( DWORD addr, WORD data );
+    WORD readWord ( DWORD addr );
+
+  private:
+    //---------------------------------------------------------------
+    Memory        &mem;
+    DWORD          addr;
+
+    bool           valid [NUM_OF_SLOTS];
+    Meta           meta  [NUM_OF_SLOTS];
+    Trace::Column  column[NUM_OF_SLOTS][NUM_OF_POINTS];
+
+    static const BYTE MAGIC = 0xA5;
+
+}; //Reference
+
+#endif
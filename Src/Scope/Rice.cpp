@@ -0,0 +1,125 @@
+//*******************************************************************
+/*!
+\file   Rice.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Lossless block coding of ADC codes (delta and Rice code)
+*/
+
+//*******************************************************************
+#include "Rice.h"
+
+//*******************************************************************
+//
+// Rice
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+WORD Rice::encode( const WORD *sample, WORD n, BYTE stride, BYTE *out )
+{
+  if( n < 2 )
+  {
+    return( encodeRaw( sample, n, stride, out ) );
+  }
+
+  // estimate k from the mean, k = log2( mean )
+  DWORD sum = 0;
+  for( WORD i = 1; i < n; i++ )
+  {
+    sum += getResidual( sample, i, stride );
+  }
+
+  DWORD mean = sum / ( n - 1 );
+  BYTE  k    = 0;
+  while( k < K_MAX && ( 2UL << k ) <= mean )
+  {
+    k++;
+  }
+
+  // exact size of k - 1, k and k + 1
+  BYTE  kTry[3] = { (BYTE)( k > 0 ? k - 1 : 0 ), k, (BYTE)( k < K_MAX ? k + 1 : K_MAX ) };
+  DWORD bits[3] = { 0, 0, 0 };
+
+  for( WORD i = 1; i < n; i++ )
+  {
+    WORD u = getResidual( sample, i, stride );
+
+    bits[0] += getBits( u, kTry[0] );
+    bits[1] += getBits( u, kTry[1] );
+    bits[2] += getBits( u, kTry[2] );
+  }
+
+  BYTE best = 0;
+  for( BYTE j = 1; j < 3; j++ )
+  {
+    if( bits[j] < bits[best] )
+    {
+      best = j;
+    }
+  }
+  k = kTry[best];
+
+  DWORD size = 3 + ( bits[best] + 7 ) / 8;
+
+  if( size >= getMaxSize( n ) )
+  {
+    // fallback: the code does not pay off
+    return( encodeRaw( sample, n, stride, out ) );
+  }
+
+  out[0] = k;
+  out[1] = sample[0];
+  out[2] = sample[0] >> 8;
+
+  BYTE *p      = out + 3;
+  DWORD bitBuf = 0;
+  BYTE  bitCnt = 0;
+
+  for( WORD i = 1; i < n; i++ )
+  {
+    WORD u = getResidual( sample, i, stride );
+    WORD q = u >> k;
+
+    if( q < Q_MAX )
+    {
+      // q one bits and a zero bit, then the low bits
+      bitBuf |= (DWORD)( ( 1 << q ) - 1 ) << bitCnt;
+      bitCnt += q + 1;
+      while( bitCnt >= 8 ) { *p++ = bitBuf; bitBuf >>= 8; bitCnt -= 8; }
+
+      bitBuf |= (DWORD)( u & ( ( 1 << k ) - 1 ) ) << bitCnt;
+      bitCnt += k;
+    }
+    else
+    {
+      // escape
+      bitBuf |= 0xFFFFUL << bitCnt;
+      bitCnt += Q_MAX;
+      while( bitCnt >= 8 ) { *p++ = bitBuf; bitBuf >>= 8; bitCnt -= 8; }
+
+      bitBuf |= (DWORD)u << bitCnt;
+      bitCnt += 16;
+    }
+    while( bitCnt >= 8 ) { *p++ = bitBuf; bitBuf >>= 8; bitCnt -= 8; }
+  }
+  if( bitCnt > 0 )
+  {
+    *p++ = bitBuf;
+  }
+
+  return( p - out );
+}
+
+//-------------------------------------------------------------------
+WORD Rice::encodeRaw( const WORD *sample, WORD n, BYTE stride, BYTE *out )
+{
+  out[0] = RAW;
+  for( WORD i = 0; i < n; i++ )
+  {
+    out[1 + 2*i] = sample[ i * stride ];
+    out[2 + 2*i] = sample[ i * stride ] >> 8;
+  }
+  return( getMaxSize( n ) );
+}
+
+//EOF
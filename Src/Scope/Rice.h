@@ -0,0 +1,96 @@
+//*******************************************************************
+/*!
+\file   Rice.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Lossless block coding of ADC codes (delta and Rice code)
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_RICE_H
+#define _SCOPE_RICE_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+
+//*******************************************************************
+/*!
+\class Rice
+
+\brief Encodes the samples of one channel of a block
+
+Each sample is predicted by the one before. The difference (modulo
+2^16) is mapped to an unsigned value u (0, -1, 1, -2, ... become
+0, 1, 2, 3, ...) and Rice coded with a parameter k, chosen per block:
+the quotient u >> k in unary code (q one bits and a zero bit), then
+the k low bits of u. A quotient of Q_MAX or more is sent as Q_MAX one
+bits and u with 16 bits, so a single spike costs at most 32 bits.
+
+k is estimated from the mean of u, the exact sizes of this k and its
+neighbours are compared. If the raw samples are not larger, e.g. for
+noise, the channel is sent uncoded. So the time per block is linear in
+the number of samples and the result never exceeds getMaxSize().
+
+Output (bits LSB first, little endian):
+\code
+  BYTE k                 RAW: uncoded
+  WORD sample[0]         RAW: sample[0 ... n-1]
+  codes of sample[1 ... n-1], padded to a byte
+\endcode
+*/
+class Rice
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      RAW   = 0xFF, //!< Parameter of an uncoded channel
+      K_MAX = 15,   //!< Largest Rice parameter
+      Q_MAX = 16    //!< Longest unary code, escape to 16 bit
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Encode the samples of one channel
+        \param sample First sample
+        \param n      Number of samples
+        \param stride Distance of two samples, e.g. the number of
+                      interleaved channels
+        \param out    Output of at least getMaxSize( n ) bytes
+        \return Number of bytes written
+    */
+    static WORD encode( const WORD *sample, WORD n, BYTE stride, BYTE *out );
+
+    //---------------------------------------------------------------
+    /*! Get the size of an uncoded channel, no output is larger
+    */
+    static WORD getMaxSize( WORD n )
+    {
+      return( 1 + 2 * n );
+    }
+
+  private:
+    //---------------------------------------------------------------
+    static WORD encodeRaw( const WORD *sample, WORD n, BYTE stride, BYTE *out );
+
+    //---------------------------------------------------------------
+    // Difference to the previous sample, mapped to unsigned
+    static WORD getResidual( const WORD *sample, WORD i, BYTE stride )
+    {
+      WORD d = sample[ i * stride ] - sample[ ( i - 1 ) * stride ];
+
+      return( ( d << 1 ) ^ ( ( d & 0x8000 ) ? 0xFFFF : 0 ) );
+    }
+
+    //---------------------------------------------------------------
+    // Number of bits of the code of u
+    static DWORD getBits( WORD u, BYTE k )
+    {
+      WORD q = u >> k;
+
+      return( ( q < Q_MAX ) ? q + 1 + k : Q_MAX + 16 );
+    }
+
+}; //Rice
+
+#endif
@@ -0,0 +1,573 @@
+//*******************************************************************
+/*!
+\file   Scpi.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  SCPI command parser for the remote control
+*/
+
+//*******************************************************************
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "Scpi.h"
+
+//*******************************************************************
+//
+// Scpi
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Scpi::Scpi( const Command *tableIn,
+            BYTE           numOfCommandsIn,
+            Handler       &handlerIn,
+            Stream::Link  &linkIn,
+            const char    *identIn )
+
+: handler( handlerIn ),
+  link   ( linkIn    )
+
+{
+  table         = tableIn;
+  numOfCommands = numOfCommandsIn;
+  ident         = identIn;
+
+  lineLen       = 0;
+  linePos       = 0;
+  isExecuting   = false;
+  isOverrun     = false;
+  responses     = 0;
+  isLocked      = false;
+  lockedId      = 0;
+
+  outLen        = 0;
+  outPos        = 0;
+  block         = 0;
+  blockSize     = 0;
+  generator     = 0;
+
+  errorHead     = 0;
+  errorCount    = 0;
+}
+
+//-------------------------------------------------------------------
+void Scpi::put( BYTE c )
+{
+  if( isBusy() )
+  {
+    return;
+  }
+
+  if( c == '\n' || c == '\r' )
+  {
+    if( isOverrun )
+    {
+      setError( INPUT_OVERRUN );
+      lineLen   = 0;
+      isOverrun = false;
+    }
+    else if( lineLen > 0 )
+    {
+      startLine();
+    }
+    return;
+  }
+
+  if( lineLen < LINE_SIZE - 1 )
+  {
+    line[lineLen++] = c;
+  }
+  else
+  {
+    isOverrun = true;
+  }
+}
+
+//-------------------------------------------------------------------
+void Scpi::execute( const char *str )
+{
+  if( isBusy() )
+  {
+    return;
+  }
+
+  lineLen = strlen( str );
+  if( lineLen >= LINE_SIZE )
+  {
+    setError( INPUT_OVERRUN );
+    lineLen = 0;
+    return;
+  }
+  memcpy( line, str, lineLen );
+  startLine();
+}
+
+//-------------------------------------------------------------------
+void Scpi::update( void )
+{
+  // one write per call, the link takes as much as it can send
+  if( outPos < outLen )
+  {
+    outPos += link.write( (const BYTE *)out + outPos, outLen - outPos );
+    return;
+  }
+
+  if( blockSize == 0 && generator )
+  {
+    WORD size = 0;
+
+    block     = generator->getData( size );
+    blockSize = size;
+    if( !block )
+    {
+      // end of the data, the terminator of the line follows
+      generator = 0;
+    }
+  }
+
+  if( blockSize > 0 )
+  {
+    WORD n = link.write( block, ( blockSize > 0xFFFF ) ? 0xFFFF : blockSize );
+
+    block     += n;
+    blockSize -= n;
+    return;
+  }
+
+  outPos = 0;
+  outLen = 0;
+
+  if( isExecuting )
+  {
+    executeNext();
+  }
+}
+
+//-------------------------------------------------------------------
+void Scpi::print( const char *format, ... )
+{
+  va_list args;
+
+  if( outLen >= OUTPUT_SIZE - 1 )
+  {
+    return;
+  }
+  if( responses++ > 0 )
+  {
+    out[outLen++] = ';';
+  }
+
+  va_start( args, format );
+  int n = vsnprintf( out + outLen, OUTPUT_SIZE - outLen, format, args );
+  va_end( args );
+
+  if( n > 0 )
+  {
+    outLen = ( outLen + n < OUTPUT_SIZE - 1 ) ? outLen + n : OUTPUT_SIZE - 1;
+  }
+}
+
+//-------------------------------------------------------------------
+void Scpi::sendBlock( const BYTE *data, DWORD size )
+{
+  char length[12];
+
+  snprintf( length, sizeof(length), "%lu", (unsigned long)size );
+  print( "#%d%s", (int)strlen( length ), length );
+
+  block     = data;
+  blockSize = size;
+}
+
+//-------------------------------------------------------------------
+void Scpi::sendBlock( Generator &gen )
+{
+  print( "#0" );
+
+  generator = &gen;
+}
+
+//-------------------------------------------------------------------
+void Scpi::setError( int err )
+{
+  if( errorCount < ERROR_QUEUE )
+  {
+    error[ ( errorHead + errorCount ) % ERROR_QUEUE ] = err;
+    errorCount++;
+  }
+  else
+  {
+    // the newest entry reports the overflow
+    error[ ( errorHead + ERROR_QUEUE - 1 ) % ERROR_QUEUE ] = QUEUE_OVERFLOW;
+  }
+}
+
+//-------------------------------------------------------------------
+bool Scpi::getValue( const char *param, int &value, int exp )
+{
+  const char *p        = param;
+  DWORD       mantissa = 0;
+  bool        isNeg    = false;
+  bool        isNumber = false;
+
+  while( isspace( *p ) ) p++;
+
+  if( *p == '+' || *p == '-' )
+  {
+    isNeg = ( *p++ == '-' );
+  }
+
+  // up to 9 significant digits, the rest only shifts the exponent
+  for( ; isdigit( *p ); p++, isNumber = true )
+  {
+    if( mantissa < 100000000 ) mantissa = mantissa * 10 + ( *p - '0' );
+    else                       exp++;
+  }
+  if( *p == '.' )
+  {
+    for( p++; isdigit( *p ); p++, isNumber = true )
+    {
+      if( mantissa < 100000000 )
+      {
+        mantissa = mantissa * 10 + ( *p - '0' );
+        exp--;
+      }
+    }
+  }
+  if( !isNumber )
+  {
+    return( false );
+  }
+
+  if( ( *p == 'E' || *p == 'e' ) && ( isdigit( p[1] ) || p[1] == '-' || p[1] == '+' ) )
+  {
+    bool isNegExp = false;
+    int  e        = 0;
+
+    p++;
+    if( *p == '+' || *p == '-' )
+    {
+      isNegExp = ( *p++ == '-' );
+    }
+    for( ; isdigit( *p ) && e < 100; p++ )
+    {
+      e = e * 10 + ( *p - '0' );
+    }
+    exp += isNegExp ? -e : e;
+  }
+
+  // prefix of the unit, SCPI has no case: "MV" is mV
+  while( isspace( *p ) ) p++;
+  switch( toupper( *p ) )
+  {
+    case 'M': exp -= 3; break;
+    case 'U': exp -= 6; break;
+    case 'K': exp += 3; break;
+  }
+
+  for( ; exp > 0; exp-- )
+  {
+    if( mantissa > 0x7FFFFFFF / 10 )
+    {
+      return( false );
+    }
+    mantissa *= 10;
+  }
+  if( exp < 0 )
+  {
+    DWORD div = 1;
+    for( ; exp < 0 && div <= 100000000; exp++ )
+    {
+      div *= 10;
+    }
+    mantissa = ( exp < 0 ) ? 0 : ( mantissa + div/2 ) / div;
+  }
+  if( mantissa > 0x7FFFFFFF )
+  {
+    return( false );
+  }
+
+  value = isNeg ? -(int)mantissa : (int)mantissa;
+  return( true );
+}
+
+//-------------------------------------------------------------------
+bool Scpi::isMnemonic( const char *param, const char *pattern, BYTE *suffix )
+{
+  while( isspace( *param ) ) param++;
+
+  BYTE len = 0;
+  while( isalpha( param[len] ) ) len++;
+
+  if( !isNode( param, len, pattern, strlen( pattern ) ) )
+  {
+    return( false );
+  }
+
+  const char *p = param + len;
+  int         n = 1;
+
+  if( isdigit( *p ) )
+  {
+    if( !suffix )
+    {
+      return( false );
+    }
+    for( n = 0; isdigit( *p ) && n < 100; p++ )
+    {
+      n = n * 10 + ( *p - '0' );
+    }
+  }
+  if( suffix )
+  {
+    *suffix = n;
+  }
+  return( *p == 0 || isspace( *p ) );
+}
+
+//-------------------------------------------------------------------
+void Scpi::startLine( void )
+{
+  line[lineLen] = 0;
+  linePos       = 0;
+  responses     = 0;
+  isExecuting   = true;
+}
+
+//-------------------------------------------------------------------
+void Scpi::executeNext( void )
+{
+  while( linePos < lineLen && ( line[linePos] == ';' || isspace( line[linePos] ) ) )
+  {
+    linePos++;
+  }
+
+  if( linePos >= lineLen )
+  {
+    // end of the line, terminate the responses
+    isExecuting = false;
+    lineLen     = 0;
+    if( responses > 0 )
+    {
+      out[0] = '\n';
+      outLen = 1;
+    }
+    return;
+  }
+
+  // split into header and parameter, both terminated in place
+  char *header = line + linePos;
+  while( linePos < lineLen && line[linePos] != ';' && !isspace( line[linePos] ) )
+  {
+    linePos++;
+  }
+  char *headerEnd = line + linePos;
+
+  while( linePos < lineLen && isspace( line[linePos] ) )
+  {
+    linePos++;
+  }
+  char *param = line + linePos;
+
+  while( linePos < lineLen && line[linePos] != ';' )
+  {
+    linePos++;
+  }
+  char *paramEnd = line + linePos;
+
+  while( paramEnd > param && isspace( paramEnd[-1] ) )
+  {
+    paramEnd--;
+  }
+  if( linePos < lineLen )
+  {
+    linePos++; // ';'
+  }
+  *paramEnd  = 0;
+  *headerEnd = 0;
+
+  bool isQuery = ( headerEnd > header && headerEnd[-1] == '?' );
+  if( isQuery )
+  {
+    headerEnd[-1] = 0;
+  }
+
+  if( isLocked )
+  {
+    // the link is used by someone else, only the command giving it back
+    BYTE i = 0;
+    BYTE suffix;
+
+    while( i < numOfCommands && ( table[i].id != lockedId || !match( header, table[i].pattern, suffix ) ) )
+    {
+      i++;
+    }
+    if( isQuery || i >= numOfCommands )
+    {
+      setError( SETTINGS_CONFLICT );
+      return;
+    }
+  }
+
+  if( executeCommon( header, isQuery ) )
+  {
+    return;
+  }
+
+  for( BYTE i = 0; i < numOfCommands; i++ )
+  {
+    BYTE suffix;
+
+    if( match( header, table[i].pattern, suffix ) )
+    {
+      int err = handler.onCommand( *this, table[i].id, suffix, param, isQuery );
+      if( err != NO_ERROR )
+      {
+        setError( err );
+      }
+      return;
+    }
+  }
+  setError( UNDEFINED_HEADER );
+}
+
+//-------------------------------------------------------------------
+bool Scpi::match( const char *header, const char *pattern, BYTE &suffix )
+{
+  suffix = 1;
+
+  if( *header  == ':' ) header++;
+  if( *pattern == ':' ) pattern++;
+
+  while( *pattern )
+  {
+    BYTE patternLen = 0;
+    while( pattern[patternLen] && pattern[patternLen] != ':' && pattern[patternLen] != '#' )
+    {
+      patternLen++;
+    }
+
+    BYTE len = 0;
+    while( header[len] && header[len] != ':' && !isdigit( header[len] ) )
+    {
+      len++;
+    }
+
+    if( !isNode( header, len, pattern, patternLen ) )
+    {
+      return( false );
+    }
+    header  += len;
+    pattern += patternLen;
+
+    if( *pattern == '#' )
+    {
+      pattern++;
+      if( isdigit( *header ) )
+      {
+        int n = 0;
+        for( ; isdigit( *header ) && n < 100; header++ )
+        {
+          n = n * 10 + ( *header - '0' );
+        }
+        suffix = n;
+      }
+    }
+
+    if( *pattern == ':' )
+    {
+      if( *header != ':' )
+      {
+        return( false );
+      }
+      pattern++;
+      header++;
+    }
+  }
+  return( *header == 0 );
+}
+
+//-------------------------------------------------------------------
+bool Scpi::executeCommon( const char *header, bool isQuery )
+{
+  BYTE suffix;
+
+  if( match( header, "*IDN", suffix ) && isQuery )
+  {
+    print( "%s", ident );
+  }
+  else if( match( header, "*OPC", suffix ) && isQuery )
+  {
+    print( "1" );
+  }
+  else if( match( header, "*CLS", suffix ) && !isQuery )
+  {
+    errorCount = 0;
+  }
+  else if( match( header, ":SYSTem:ERRor", suffix ) && isQuery )
+  {
+    int err = NO_ERROR;
+
+    if( errorCount > 0 )
+    {
+      err       = error[errorHead];
+      errorHead = ( errorHead + 1 ) % ERROR_QUEUE;
+      errorCount--;
+    }
+    print( "%d,\"%s\"", err, getErrorText( err ) );
+  }
+  else
+  {
+    return( false );
+  }
+  return( true );
+}
+
+//-------------------------------------------------------------------
+bool Scpi::isNode( const char *in, BYTE len, const char *pattern, BYTE patternLen )
+{
+  // the short form are the leading upper case letters
+  BYTE shortLen = 0;
+  while( shortLen < patternLen && !islower( pattern[shortLen] ) )
+  {
+    shortLen++;
+  }
+
+  if( len != shortLen && len != patternLen )
+  {
+    return( false );
+  }
+  for( BYTE i = 0; i < len; i++ )
+  {
+    if( toupper( in[i] ) != toupper( pattern[i] ) )
+    {
+      return( false );
+    }
+  }
+  return( true );
+}
+
+//-------------------------------------------------------------------
+const char *Scpi::getErrorText( int err )
+{
+  switch( err )
+  {
+    case NO_ERROR:          return( "No error" );
+    case COMMAND_ERROR:     return( "Command error" );
+    case SYNTAX_ERROR:      return( "Syntax error" );
+    case MISSING_PARAMETER: return( "Missing parameter" );
+    case UNDEFINED_HEADER:  return( "Undefined header" );
+    case HEADER_SUFFIX:     return( "Header suffix out of range" );
+    case SETTINGS_CONFLICT: return( "Settings conflict" );
+    case DATA_OUT_OF_RANGE: return( "Data out of range" );
+    case ILLEGAL_PARAMETER: return( "Illegal parameter value" );
+    case DATA_STALE:        return( "Data stale" );
+    case QUEUE_OVERFLOW:    return( "Queue overflow" );
+    case INPUT_OVERRUN:     return( "Input buffer overrun" );
+  }
+  return( "Error" );
+}
+
+//EOF
@@ -0,0 +1,290 @@
+//*******************************************************************
+/*!
+\file   Scpi.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  SCPI command parser for the remote control
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_SCPI_H
+#define _SCOPE_SCPI_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+#include "Stream.h"
+
+//*******************************************************************
+/*!
+\class Scpi
+
+\brief Parses SCPI program messages and sends the responses to a link
+
+The commands are given by a table of header patterns, e.g.
+\code
+  const Scpi::Command table[] =
+  {
+    { ":CHANnel#:SCALe", CMD_SCALE },
+    { ":MEASure:VPP",    CMD_VPP   }
+  };
+\endcode
+Upper case letters are the short form, the pattern matches the short
+and the long form in any case. '#' takes a numeric suffix (default 1),
+e.g. CHAN2. A trailing '?' makes a query. The leading ':' is optional.
+The Handler gets the id of the matching entry and the parameter
+string. Several commands of a line are separated by ';', each is
+taken from the root. *IDN?, *CLS, *OPC? and :SYSTem:ERRor? are
+handled here.
+
+A line is executed one command per update(), after the response of
+the previous command has been passed to the link. Responses of one
+line are separated by ';' and terminated by '\n'. A binary block
+(IEEE 488.2 definite length, "#<n><length><data>") is sent directly
+from the memory of the data, it must not change until isBusy() is
+false. Data of unknown length, e.g. a compressed image, is taken from
+a Generator piece by piece and sent as indefinite length block
+("#0<data>\n"), the data itself has to show its end. So neither
+parsing nor sending ever waits, and nothing is allocated.
+
+Input either byte by byte (put()) or as complete line (execute()), but
+only if isBusy() is false.
+
+If the link is shared, e.g. with a Stream, lock() restricts the parser
+to the one command giving the link back. Everything else is rejected
+without a response.
+*/
+class Scpi
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Entry of the command table
+    */
+    class Command
+    {
+      public:
+        const char *pattern; //!< Header, see above
+        BYTE        id;      //!< Passed to the handler
+    };
+
+    //---------------------------------------------------------------
+    /*! Executes the commands of the table
+    */
+    class Handler
+    {
+      public:
+        //-----------------------------------------------------------
+        /*! Execute a command, a query responds with print() or
+            sendBlock()
+            \param scpi    Parser, which received the command
+            \param id      Id of the table entry
+            \param suffix  Numeric suffix of the header
+            \param param   Parameter, "" if none
+            \param isQuery true, if the header ends with '?'
+            \return 0 or a SCPI error number, e.g. ILLEGAL_PARAMETER
+        */
+        virtual int onCommand( Scpi       &scpi,
+                               BYTE        id,
+                               BYTE        suffix,
+                               const char *param,
+                               bool        isQuery ) = 0;
+    };
+
+    //---------------------------------------------------------------
+    /*! Source of a response of unknown length
+    */
+    class Generator
+    {
+      public:
+        //-----------------------------------------------------------
+        /*! Get the next piece of the data, valid until the next call
+            \param size Number of bytes
+            \return Data or 0 at the end
+        */
+        virtual const BYTE *getData( WORD &size ) = 0;
+    };
+
+    //---------------------------------------------------------------
+    /*! SCPI error numbers
+    */
+    enum Error
+    {
+      NO_ERROR          =    0,
+      COMMAND_ERROR     = -100,
+      SYNTAX_ERROR      = -102,
+      MISSING_PARAMETER = -109,
+      UNDEFINED_HEADER  = -113,
+      HEADER_SUFFIX     = -114,
+      SETTINGS_CONFLICT = -221,
+      DATA_OUT_OF_RANGE = -222,
+      ILLEGAL_PARAMETER = -224,
+      DATA_STALE        = -230,
+      QUEUE_OVERFLOW    = -350,
+      INPUT_OVERRUN     = -363
+    };
+
+    //---------------------------------------------------------------
+    enum
+    {
+      LINE_SIZE   = 128, //!< Max. length of a line
+      OUTPUT_SIZE = 64,  //!< Max. length of a text response
+      ERROR_QUEUE = 8    //!< Depth of the error queue
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a parser
+        \param table         Command table
+        \param numOfCommands Number of entries
+        \param handler       Executes the commands
+        \param link          Receives the responses
+        \param ident         Response of *IDN?
+    */
+    Scpi( const Command *table,
+          BYTE           numOfCommands,
+          Handler       &handler,
+          Stream::Link  &link,
+          const char    *ident );
+
+    //---------------------------------------------------------------
+    /*! Take the next received byte, '\n' or '\r' completes a line
+    */
+    void put( BYTE c );
+
+    //---------------------------------------------------------------
+    /*! Take a complete line
+    */
+    void execute( const char *line );
+
+    //---------------------------------------------------------------
+    /*! Pass the pending response to the link or execute the next
+        command, to be called in the main loop
+    */
+    void update( void );
+
+    //---------------------------------------------------------------
+    /*! A line is executed or its response is pending
+    */
+    bool isBusy( void ) const
+    {
+      return( isExecuting || outPos < outLen || blockSize > 0 || generator );
+    }
+
+    //---------------------------------------------------------------
+    /*! Accept only one command, which must not respond. Every other
+        command and every query is rejected with SETTINGS_CONFLICT, so
+        nothing is passed to the link.
+        \param id Id of the table entry still accepted
+    */
+    void lock( BYTE id )
+    {
+      isLocked = true;
+      lockedId = id;
+    }
+
+    //---------------------------------------------------------------
+    /*! Accept all commands again
+    */
+    void unlock( void )
+    {
+      isLocked = false;
+    }
+
+    //---------------------------------------------------------------
+    /*! Respond to a query with text (printf format)
+    */
+    void print( const char *format, ... );
+
+    //---------------------------------------------------------------
+    /*! Respond to a query with a definite length block
+        \param data Data, sent without copy
+        \param size Number of bytes
+    */
+    void sendBlock( const BYTE *data, DWORD size );
+
+    //---------------------------------------------------------------
+    /*! Respond to a query with an indefinite length block
+        \param gen Source of the data
+    */
+    void sendBlock( Generator &gen );
+
+    //---------------------------------------------------------------
+    /*! Add an error to the queue
+    */
+    void setError( int error );
+
+    //---------------------------------------------------------------
+    /*! Get a decimal parameter in a smaller unit, e.g. "1.5", "1500E-3"
+        or "1500mV" as mV with exp 3. A unit after the number is
+        ignored, the prefixes m, u and k are taken into account.
+        \param param Parameter
+        \param value Value * 10^exp
+        \param exp   Exponent of the unit
+        \return false, if the parameter is no number
+    */
+    static bool getValue( const char *param, int &value, int exp );
+
+    //---------------------------------------------------------------
+    /*! Compare a parameter with a mnemonic, e.g. "POSitive"
+        \param param   Parameter
+        \param pattern Mnemonic, upper case letters are the short form
+        \param suffix  Numeric suffix, e.g. of "CHAN2" (default 1).
+                       If 0, a suffix is not allowed.
+    */
+    static bool isMnemonic( const char *param, const char *pattern, BYTE *suffix = 0 );
+
+  private:
+    //---------------------------------------------------------------
+    // Start the execution of the received line
+    void startLine( void );
+
+    //---------------------------------------------------------------
+    // Execute the next command of the line
+    void executeNext( void );
+
+    //---------------------------------------------------------------
+    // Match the input header with a pattern
+    static bool match( const char *header, const char *pattern, BYTE &suffix );
+
+    //---------------------------------------------------------------
+    // Handle the common commands, false if not found
+    bool executeCommon( const char *header, bool isQuery );
+
+    //---------------------------------------------------------------
+    // Compare an input node of len characters with a pattern node
+    static bool isNode( const char *in, BYTE len, const char *pattern, BYTE patternLen );
+
+    //---------------------------------------------------------------
+    static const char *getErrorText( int error );
+
+  private:
+    //---------------------------------------------------------------
+    const Command *table;
+    BYTE           numOfCommands;
+    Handler       &handler;
+    Stream::Link  &link;
+    const char    *ident;
+
+    char           line[LINE_SIZE];
+    WORD           lineLen;
+    WORD           linePos;     // next command
+    bool           isExecuting;
+    bool           isOverrun;   // line too long, it is discarded
+    BYTE           responses;   // responses of the line
+    bool           isLocked;
+    BYTE           lockedId;    // only command accepted while locked
+
+    char           out[OUTPUT_SIZE];
+    WORD           outLen;
+    WORD           outPos;
+
+    const BYTE    *block;
+    DWORD          blockSize;
+    Generator     *generator;
+
+    int            error[ERROR_QUEUE];
+    BYTE           errorHead;
+    BYTE           errorCount;
+
+}; //Scpi
+
+#endif
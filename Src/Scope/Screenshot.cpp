@@ -0,0 +1,343 @@
+//*******************************************************************
+/*!
+\file   Screenshot.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Framebuffer as PNG image, compressed row by row
+*/
+
+//*******************************************************************
+#include <string.h>
+
+#include "Screenshot.h"
+
+//*******************************************************************
+//
+// Screenshot
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Screenshot::Screenshot( const WORD *frameIn,
+                        WORD        widthIn,
+                        WORD        heightIn,
+                        BYTE        layoutIn )
+{
+  frame  = frameIn;
+  width  = widthIn;
+  height = heightIn;
+  layout = layoutIn;
+
+  row      = new WORD[ width ];
+  prevRow  = new WORD[ width ];
+  filtered = new BYTE[ 3 * width + 1 ];
+
+  // worst case: every byte a 9 bit literal, plus chunk, zlib header
+  // and checksum
+  out = new BYTE[ ( 3 * width + 1 ) * 9 / 8 + 32 ];
+
+  outLen     = 0;
+  chunkStart = 0;
+  bitBuf     = 0;
+  bitCnt     = 0;
+  adler      = 1;
+  y          = 0;
+  state      = IDLE;
+}
+
+//-------------------------------------------------------------------
+void Screenshot::start( void )
+{
+  state = HEADER;
+}
+
+//-------------------------------------------------------------------
+const BYTE *Screenshot::getData( WORD &size )
+{
+  static const BYTE signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+  outLen = 0;
+
+  switch( state )
+  {
+    default:
+      size = 0;
+      return( 0 );
+
+    case HEADER:
+      for( BYTE i = 0; i < sizeof(signature); i++ )
+      {
+        putByte( signature[i] );
+      }
+      beginChunk( "IHDR" );
+      putDWord( width );
+      putDWord( height );
+      putByte( 8 ); // bit depth
+      putByte( 2 ); // RGB
+      putByte( 0 ); // deflate
+      putByte( 0 ); // adaptive filter
+      putByte( 0 ); // no interlace
+      endChunk();
+
+      y      = 0;
+      bitBuf = 0;
+      bitCnt = 0;
+      adler  = 1;
+      state  = ROWS;
+      break;
+
+    case ROWS:
+      beginChunk( "IDAT" );
+      if( y == 0 )
+      {
+        putByte( 0x78 );    // zlib: deflate, 32K window
+        putByte( 0x01 );    //       no dictionary, check bits
+        putBits( 1, 1 );    // last block
+        putBits( 1, 2 );    // fixed Huffman code
+      }
+
+      { WORD *tmp = prevRow; prevRow = row; row = tmp; }
+      readRow( y, row );
+      filterRow();
+      encodeRow();
+
+      if( ++y >= height )
+      {
+        putCode( 0, 7 );    // end of block
+        if( bitCnt > 0 )
+        {
+          putBits( 0, 8 - bitCnt );
+        }
+        putDWord( adler );
+        state = END;
+      }
+      endChunk();
+      break;
+
+    case END:
+      beginChunk( "IEND" );
+      endChunk();
+      state = IDLE;
+      break;
+  }
+
+  size = outLen;
+  return( out );
+}
+
+//-------------------------------------------------------------------
+void Screenshot::readRow( WORD yIn, WORD *dest ) const
+{
+  if( layout == ROTATED_90 )
+  {
+    const WORD *src = &frame[ height - 1 - yIn ];
+    for( WORD x = 0; x < width; x++ )
+    {
+      dest[x] = src[ (DWORD)x * height ];
+    }
+  }
+  else
+  {
+    memcpy( dest, &frame[ (DWORD)yIn * width ], width * sizeof(WORD) );
+  }
+}
+
+//-------------------------------------------------------------------
+void Screenshot::filterRow( void )
+{
+  // RGB888 of a RGB565 color, channel 0: red, 1: green, 2: blue
+  #define RGB888( c, ch )   ( (ch) == 0 ? ( ( (c) >> 8 ) & 0xF8 ) | ( (c) >> 13 )                \
+                            : (ch) == 1 ? ( ( (c) >> 3 ) & 0xFC ) | ( ( (c) >> 9 ) & 0x03 )      \
+                            :             ( ( (c) << 3 ) & 0xF8 ) | ( ( (c) >> 2 ) & 0x07 ) )
+
+  // sum of the absolute differences decides
+  DWORD costSub = 0;
+  DWORD costUp  = 0;
+
+  for( WORD x = 0; x < width; x++ )
+  {
+    for( BYTE ch = 0; ch < 3; ch++ )
+    {
+      BYTE a = RGB888( row[x], ch );
+      BYTE l = ( x > 0 ) ? RGB888( row[x - 1], ch ) : 0;
+      BYTE u = ( y > 0 ) ? RGB888( prevRow[x], ch ) : 0;
+
+      costSub += ( a > l ) ? a - l : l - a;
+      costUp  += ( a > u ) ? a - u : u - a;
+    }
+  }
+
+  bool isUp   = ( costUp < costSub );
+  filtered[0] = isUp ? 2 : 1;
+
+  BYTE *p = &filtered[1];
+  for( WORD x = 0; x < width; x++ )
+  {
+    for( BYTE ch = 0; ch < 3; ch++ )
+    {
+      BYTE a = RGB888( row[x], ch );
+      BYTE b = isUp ? ( ( y > 0 ) ? RGB888( prevRow[x], ch ) : 0 )
+                    : ( ( x > 0 ) ? RGB888( row[x - 1], ch ) : 0 );
+      *p++ = a - b;
+    }
+  }
+  #undef RGB888
+}
+
+//-------------------------------------------------------------------
+void Screenshot::encodeRow( void )
+{
+  DWORD n  = 3 * (DWORD)width + 1;
+  DWORD s1 = adler & 0xFFFF;
+  DWORD s2 = adler >> 16;
+
+  // less than 5552 bytes per row, so one modulo per row is enough
+  for( DWORD i = 0; i < n; i++ )
+  {
+    s1 += filtered[i];
+    s2 += s1;
+  }
+  adler = ( ( s2 % 65521 ) << 16 ) | ( s1 % 65521 );
+
+  // literal, then repeats of it as matches with distance 1
+  for( DWORD i = 0; i < n; )
+  {
+    BYTE b = filtered[i++];
+
+    putLiteral( b );
+    while( true )
+    {
+      WORD run = 0;
+      while( i + run < n && filtered[i + run] == b && run < 258 )
+      {
+        run++;
+      }
+      if( run < 3 )
+      {
+        break;
+      }
+      putMatch( run );
+      i += run;
+    }
+  }
+}
+
+//-------------------------------------------------------------------
+void Screenshot::beginChunk( const char *type )
+{
+  putDWord( 0 ); // length, set by endChunk()
+  chunkStart = outLen;
+  for( BYTE i = 0; i < 4; i++ )
+  {
+    putByte( type[i] );
+  }
+}
+
+//-------------------------------------------------------------------
+void Screenshot::endChunk( void )
+{
+  DWORD length = outLen - chunkStart - 4;
+
+  out[chunkStart - 4] = length >> 24;
+  out[chunkStart - 3] = length >> 16;
+  out[chunkStart - 2] = length >> 8;
+  out[chunkStart - 1] = length;
+
+  putDWord( crc32( 0, &out[chunkStart], outLen - chunkStart ) );
+}
+
+//-------------------------------------------------------------------
+void Screenshot::putByte( BYTE data )
+{
+  out[outLen++] = data;
+}
+
+//-------------------------------------------------------------------
+void Screenshot::putDWord( DWORD data )
+{
+  putByte( data >> 24 );
+  putByte( data >> 16 );
+  putByte( data >> 8  );
+  putByte( data       );
+}
+
+//-------------------------------------------------------------------
+void Screenshot::putBits( DWORD value, BYTE n )
+{
+  bitBuf |= value << bitCnt;
+  bitCnt += n;
+  while( bitCnt >= 8 )
+  {
+    out[outLen++] = bitBuf;
+    bitBuf >>= 8;
+    bitCnt  -= 8;
+  }
+}
+
+//-------------------------------------------------------------------
+void Screenshot::putCode( WORD code, BYTE n )
+{
+  // Huffman codes are sent MSB first
+  WORD rev = 0;
+  for( BYTE i = 0; i < n; i++ )
+  {
+    rev = ( rev << 1 ) | ( ( code >> i ) & 1 );
+  }
+  putBits( rev, n );
+}
+
+//-------------------------------------------------------------------
+void Screenshot::putLiteral( BYTE data )
+{
+  if( data < 144 ) putCode( 0x30  +   data,         8 );
+  else             putCode( 0x190 + ( data - 144 ), 9 );
+}
+
+//-------------------------------------------------------------------
+void Screenshot::putMatch( WORD length )
+{
+  // length codes 257 ... 285 (RFC 1951, 3.2.5)
+  static const WORD base [29] = {   3,   4,   5,   6,   7,   8,   9,  10,
+                                   11,  13,  15,  17,  19,  23,  27,  31,
+                                   35,  43,  51,  59,  67,  83,  99, 115,
+                                  131, 163, 195, 227, 258 };
+  static const BYTE extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0,
+                                  1, 1, 1, 1, 2, 2, 2, 2,
+                                  3, 3, 3, 3, 4, 4, 4, 4,
+                                  5, 5, 5, 5, 0 };
+  BYTE i = 28;
+  while( base[i] > length )
+  {
+    i--;
+  }
+
+  WORD symbol = 257 + i;
+  if( symbol < 280 ) putCode( symbol - 256,          7 );
+  else               putCode( 0xC0 + symbol - 280,   8 );
+
+  putBits( length - base[i], extra[i] );
+  putCode( 0, 5 ); // distance code 0: distance 1
+}
+
+//-------------------------------------------------------------------
+DWORD Screenshot::crc32( DWORD crc, const BYTE *data, DWORD size )
+{
+  // 4 bit table of the PNG/zlib CRC polynomial
+  static const DWORD table[16] =
+  {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+  };
+
+  crc = ~crc;
+  for( DWORD i = 0; i < size; i++ )
+  {
+    crc ^= data[i];
+    crc  = ( crc >> 4 ) ^ table[ crc & 0x0F ];
+    crc  = ( crc >> 4 ) ^ table[ crc & 0x0F ];
+  }
+  return( ~crc );
+}
+
+//EOF
@@ -0,0 +1,141 @@
+//*******************************************************************
+/*!
+\file   Screenshot.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Framebuffer as PNG image, compressed row by row
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_SCREENSHOT_H
+#define _SCOPE_SCREENSHOT_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+#include "Scpi.h"
+
+//*******************************************************************
+/*!
+\class Screenshot
+
+\brief Encodes an RGB565 framebuffer as PNG, one row per getData()
+
+Only a row is converted and compressed at a time, so the working
+buffer is a few KByte instead of a copy of the framebuffer:
+- the row is converted to RGB888 and filtered with "Sub" or "Up"
+  (PNG filter types 1 and 2), whichever gives smaller differences.
+  Areas of one color and rows equal to the row above become zeros.
+- the filtered bytes are deflate coded with the fixed Huffman code and
+  runs of equal bytes as matches of distance 1 (like zlib's Z_RLE).
+- the compressed row is sent as one IDAT chunk.
+
+A scope screen is mostly background and vertical or horizontal grid
+lines, it is compressed to a few percent of the raw size.
+
+The framebuffer is read while the image is sent, so drawing in the
+meantime may show up in the lower rows.
+
+\code
+  screenshot.start();
+  scpi.sendBlock( screenshot );
+\endcode
+*/
+class Screenshot : public Scpi::Generator
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Memory layout of the framebuffer
+    */
+    enum Layout
+    {
+      ROW_MAJOR = 0, //!< Pixel (x,y) at frame[y * width + x]
+      ROTATED_90     //!< Portrait panel, pixel (x,y) at frame[x * height + height-1-y]
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate an encoder
+        \param frame  RGB565 framebuffer
+        \param width  Screen width [px]
+        \param height Screen height [px]
+        \param layout Memory layout
+    */
+    Screenshot( const WORD *frame, WORD width, WORD height, BYTE layout );
+
+    //---------------------------------------------------------------
+    /*! Start a new image
+    */
+    void start( void );
+
+    //---------------------------------------------------------------
+    /*! An image is being encoded
+    */
+    bool isBusy( void ) const
+    {
+      return( state != IDLE );
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the next part of the PNG file, valid until the next call
+    */
+    virtual const BYTE *getData( WORD &size );
+
+  private:
+    //---------------------------------------------------------------
+    void readRow( WORD y, WORD *row ) const;
+
+    //---------------------------------------------------------------
+    // Filter the actual row into filtered[], with the filter byte
+    void filterRow( void );
+
+    //---------------------------------------------------------------
+    // Deflate the filtered row
+    void encodeRow( void );
+
+    //---------------------------------------------------------------
+    void beginChunk( const char *type );
+    void endChunk  ( void );
+
+    //---------------------------------------------------------------
+    void putByte    ( BYTE  data );
+    void putDWord   ( DWORD data ); // big endian
+    void putBits    ( DWORD value, BYTE n );
+    void putCode    ( WORD  code,  BYTE n );
+    void putLiteral ( BYTE  data );
+    void putMatch   ( WORD  length );
+
+    //---------------------------------------------------------------
+    static DWORD crc32( DWORD crc, const BYTE *data, DWORD size );
+
+  private:
+    //---------------------------------------------------------------
+    enum State
+    {
+      IDLE = 0,
+      HEADER,
+      ROWS,
+      END
+    };
+
+    //---------------------------------------------------------------
+    const WORD *frame;
+    WORD        width;
+    WORD        height;
+    BYTE        layout;
+
+    WORD       *row;      // RGB565 of the actual row
+    WORD       *prevRow;  // RGB565 of the row above
+    BYTE       *filtered; // filter type and 3*width bytes
+    BYTE       *out;      // PNG data of one getData()
+    WORD        outLen;
+    WORD        chunkStart;
+
+    DWORD       bitBuf;   // deflate bits not written yet, LSB first
+    BYTE        bitCnt;
+    DWORD       adler;    // zlib checksum of the filtered rows
+    WORD        y;
+    BYTE        state;
+
+}; //Screenshot
+
+#endif
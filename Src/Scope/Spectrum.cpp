@@ -0,0 +1,108 @@
+//*******************************************************************
+/*!
+\file   Spectrum.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Log magnitude display of an FFT
+*/
+
+//*******************************************************************
+#include "Spectrum.h"
+
+//*******************************************************************
+//
+// Spectrum
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Spectrum::Spectrum( ScreenGraphic &screenIn, const Fft &fftIn )
+
+: screen( screenIn ),
+  fft   ( fftIn )
+
+{
+}
+
+//-------------------------------------------------------------------
+void Spectrum::draw( const Trace::Window &window,
+                     WORD                 samplePeriod,
+                     WORD                 color,
+                     WORD                 markerColor )
+{
+  DWORD numOfBins = fft.getSize() / 2;   // bin 1 ... size/2, DC is removed
+  int   bottom    = window.y + window.height - 1;
+
+  DWORD peakBin = 1;
+  int   peakdB  = -DB_RANGE;
+  int   peakX   = window.x;
+
+  DWORD bin = 1;
+  for( WORD c = 0; c < window.width; c++ )
+  {
+    // bins of this column, at least one
+    DWORD last = ( (DWORD)( c + 1 ) * numOfBins ) / window.width;
+    if( last < bin )
+    {
+      last = bin;
+    }
+
+    int dB = -DB_RANGE;
+    for( DWORD k = bin; k <= last && k <= numOfBins; k++ )
+    {
+      int level = fft.getDeciBel( k );
+      if( level > dB )
+      {
+        dB = level;
+      }
+      if( level > peakdB )
+      {
+        peakdB  = level;
+        peakBin = k;
+        peakX   = window.x + c;
+      }
+    }
+    bin = last + 1;
+
+    int y = toY( window, dB );
+    if( y < bottom )
+    {
+      screen.drawLine( window.x + c, y, window.x + c, bottom, 1, color );
+    }
+  }
+
+  // peak marker: small triangle above the bin and its readout
+  int y = toY( window, peakdB );
+  if( y < window.y + 8 )
+  {
+    y = window.y + 8;
+  }
+  screen.drawLine( peakX - 4, y - 8, peakX + 4, y - 8, 1, markerColor );
+  screen.drawLine( peakX - 4, y - 8, peakX,     y - 2, 1, markerColor );
+  screen.drawLine( peakX + 4, y - 8, peakX,     y - 2, 1, markerColor );
+
+  // f = k * fs / size, fs = 1/samplePeriod
+  DWORD freq  = ( peakBin * 1000000UL ) / ( (DWORD)samplePeriod * fft.getSize() );
+  int   tenth = ( peakdB < 0 ? -peakdB : peakdB ) % 10;
+
+  screen.drawText( window.x + 10, window.y + 10, "peak %d Hz %s%d.%d dB",
+                   (int)freq,
+                   ( peakdB < 0 ) ? "-" : "",
+                   ( peakdB < 0 ? -peakdB : peakdB ) / 10,
+                   tenth );
+}
+
+//-------------------------------------------------------------------
+int Spectrum::toY( const Trace::Window &window, int dB )
+{
+  if( dB > 0 )
+  {
+    dB = 0;
+  }
+  if( dB < -DB_RANGE )
+  {
+    dB = -DB_RANGE;
+  }
+  return( window.y + ( -dB * (int)( window.height - 1 ) ) / DB_RANGE );
+}
+
+//EOF
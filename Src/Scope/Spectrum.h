@@ -0,0 +1,71 @@
+//*******************************************************************
+/*!
+\file   Spectrum.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Log magnitude display of an FFT
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_SPECTRUM_H
+#define _SCOPE_SPECTRUM_H
+
+//*******************************************************************
+#include "Trace.h"
+#include "Fft.h"
+
+//*******************************************************************
+/*!
+\class Spectrum
+
+\brief Draws the magnitude of the bins 1 ... size/2 of an Fft
+
+The top border of the window is 0 dBFS, the bottom border -DB_RANGE.
+Several bins falling onto one column are reduced to their maximum,
+so a narrow peak is never lost. The bin with the highest magnitude is
+marked and its frequency and level are printed.
+*/
+class Spectrum
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      DB_RANGE = 800 //!< Range of the window height [0.1 dB]
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a spectrum display
+        \param screen Target screen
+        \param fft    Transform to be shown
+    */
+    Spectrum( ScreenGraphic &screen, const Fft &fft );
+
+    //---------------------------------------------------------------
+    /*! Draw the magnitude of the last transform
+        \param window       Screen area (the voltage range is not used)
+        \param samplePeriod Sample period of the capture [us]
+        \param color        Color of the bins
+        \param markerColor  Color of the peak marker and text
+    */
+    void draw( const Trace::Window &window,
+               WORD                 samplePeriod,
+               WORD                 color,
+               WORD                 markerColor );
+
+    //---------------------------------------------------------------
+    /*! Get the y coordinate of a level
+        \param window Screen area
+        \param dB     Level [0.1 dBFS]
+    */
+    static int toY( const Trace::Window &window, int dB );
+
+  private:
+    //---------------------------------------------------------------
+    ScreenGraphic &screen;
+    const Fft     &fft;
+
+}; //Spectrum
+
+#endif
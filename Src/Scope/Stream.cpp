@@ -0,0 +1,161 @@
+//*******************************************************************
+/*!
+\file   Stream.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Framed binary stream of the raw samples
+*/
+
+//*******************************************************************
+#include "Stream.h"
+
+//*******************************************************************
+//
+// Stream
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Stream::Stream( BYTE channelMaskIn, WORD samplePeriod, BYTE codingIn )
+{
+  channelMask = channelMaskIn & ( CHANNEL_A | CHANNEL_B );
+  sampleRate  = 1000000UL / samplePeriod;
+  blockWords  = BLOCK_SIZE * (   ( ( channelMask & CHANNEL_A ) ? 1 : 0 )
+                               + ( ( channelMask & CHANNEL_B ) ? 1 : 0 ) );
+  block       = new Block[ NUM_OF_BLOCKS ];
+  coding      = codingIn;
+  coded       = 0;
+  codedSize   = 0;
+  isCoded     = false;
+
+  head         = 0;
+  tail         = 0;
+  pos          = 0;
+  sent         = 0;
+  sequence     = 0;
+  dropped      = 0;
+  first        = 0;
+  startCount   = 0;
+  startAck     = 0;
+  startRequest = 0;
+  isRunning    = false;
+
+  if( coding == RICE )
+  {
+    coded = new BYTE[ sizeof( Header ) + 2 * Rice::getMaxSize( BLOCK_SIZE ) ];
+  }
+}
+
+//-------------------------------------------------------------------
+void Stream::start( void )
+{
+  // the ring is reset by add() and getBlock(), each in its own context
+  startRequest++;
+  isRunning = ( blockWords > 0 );
+}
+
+//-------------------------------------------------------------------
+void Stream::transmit( Link &link )
+{
+  WORD        size;
+  const BYTE *data;
+
+  while( ( data = getBlock( size ) ) != 0 )
+  {
+    sent += link.write( data + sent, size - sent );
+
+    if( sent < size )
+    {
+      return; // link busy, continue with the next call
+    }
+    sent = 0;
+    releaseBlock();
+  }
+}
+
+//-------------------------------------------------------------------
+const BYTE *Stream::getBlock( WORD &size )
+{
+  // skip the blocks before a start(), but not within a frame
+  BYTE count = startCount;
+
+  if( count != startAck && sent == 0 )
+  {
+    __sync_synchronize(); // startCount is read before first
+    tail     = first;
+    isCoded  = false;
+    startAck = count;
+  }
+
+  if( tail == head )
+  {
+    return( 0 );
+  }
+  __sync_synchronize(); // head is read before the samples
+
+  Block &blk = block[tail];
+
+  if( coding == RICE )
+  {
+    // getBlock() is called again while the frame is sent
+    if( !isCoded )
+    {
+      encode( blk );
+      isCoded = true;
+    }
+    size = codedSize;
+    return( coded );
+  }
+
+  setHeader( blk.header, RAW, blockWords * sizeof( WORD ) );
+
+  // header and samples are adjacent, so they are one piece
+  size = sizeof( Header ) + blockWords * sizeof( WORD );
+
+  return( (const BYTE *)&blk );
+}
+
+//-------------------------------------------------------------------
+void Stream::releaseBlock( void )
+{
+  if( tail != head )
+  {
+    tail    = ( tail + 1 ) % NUM_OF_BLOCKS;
+    isCoded = false;
+  }
+}
+
+//-------------------------------------------------------------------
+void Stream::setHeader( Header &header, BYTE codingIn, WORD dataSize )
+{
+  // sequence and dropped are set by add()
+  header.sync         = SYNC;
+  header.version      = VERSION;
+  header.channelMask  = channelMask;
+  header.sampleRate   = sampleRate;
+  header.numOfSamples = BLOCK_SIZE;
+  header.coding       = codingIn;
+  header.reserved     = 0;
+  header.dataSize     = dataSize;
+  header.checksum     = header.getChecksum();
+}
+
+//-------------------------------------------------------------------
+void Stream::encode( const Block &blk )
+{
+  Header &header   = *(Header *)coded;
+  BYTE   *p        = coded + sizeof( Header );
+  BYTE    channels = blockWords / BLOCK_SIZE;
+
+  header = blk.header;
+
+  // channels are interleaved, so each one is coded with a stride
+  for( BYTE ch = 0; ch < channels; ch++ )
+  {
+    p += Rice::encode( &blk.sample[ch], BLOCK_SIZE, channels, p );
+  }
+
+  codedSize = p - coded;
+  setHeader( header, RICE, codedSize - sizeof( Header ) );
+}
+
+//EOF
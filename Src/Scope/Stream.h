@@ -0,0 +1,284 @@
+//*******************************************************************
+/*!
+\file   Stream.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Framed binary stream of the raw samples
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_STREAM_H
+#define _SCOPE_STREAM_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+#include "Rice.h"
+
+//*******************************************************************
+/*!
+\class Stream
+
+\brief Sends every sample of the acquisition as framed binary blocks
+
+add() is called in the timer interrupt with the codes of both
+channels. They are written into a ring of NUM_OF_BLOCKS blocks of
+BLOCK_SIZE samples per channel, interleaved A, B, A, B, ... A full
+block is passed to the main loop. If the ring is full, because the
+link is too slow, the block is discarded and counted as dropped.
+
+transmit() is called in the main loop. It puts the header in front of
+the samples of the oldest full block and passes the block as one piece
+of memory to a Link, so the samples are not copied on their way from
+the interrupt to the link. A link may accept only a part, the rest is
+passed by the next call. Alternatively a transport sending from the
+memory of the block, e.g. a USB endpoint, takes it with getBlock()
+and hands it back with releaseBlock().
+
+With the coding RICE, the samples of each channel are coded with Rice
+(delta and Rice code, uncoded if that is smaller). A block is coded
+once by the first getBlock(), in bounded time. A slowly varying signal
+takes about half the bytes or less, so the same link carries about
+twice the sample rate.
+
+Frame (little endian):
+\code
+  Header                        24 Byte
+  RAW:  WORD sample[numOfSamples * number of channels]
+  RICE: output of Rice::encode() of channel A, then of channel B
+\endcode
+The sequence number counts dropped blocks, too. So the receiver sees
+a gap as a jump of the sequence number. It resynchronizes on SYNC
+and a matching header checksum.
+
+start() only requests a restart, it may be called by the main loop or
+by another interrupt while add() runs. The next add() resets the
+writing side, the reader skips the blocks before the restart with its
+next getBlock() after the frame being sent. So each side resets only
+its own state, and a block being sent stays valid until it is
+released.
+*/
+class Stream
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Transport of the frames, e.g. USB CDC or UART
+    */
+    class Link
+    {
+      public:
+        //-----------------------------------------------------------
+        /*! Pass data without blocking
+            \param data Data
+            \param size Number of bytes
+            \return Number of bytes accepted, 0 ... size
+        */
+        virtual WORD write( const BYTE *data, WORD size ) = 0;
+    };
+
+    //---------------------------------------------------------------
+    /*! Frame header
+    */
+    class __attribute__ ((__packed__)) Header
+    {
+      public:
+        WORD  sync;         //!< SYNC
+        BYTE  version;      //!< VERSION
+        BYTE  channelMask;  //!< CHANNEL_A | CHANNEL_B
+        DWORD sequence;     //!< Block number since start()
+        DWORD sampleRate;   //!< [Hz]
+        DWORD dropped;      //!< Blocks dropped since start()
+        WORD  numOfSamples; //!< Samples per channel
+        BYTE  coding;       //!< RAW or RICE
+        BYTE  reserved;     //!< 0
+        WORD  dataSize;     //!< Bytes following the header
+        WORD  checksum;     //!< Sum of the WORDs before, modulo 2^16
+
+        //-----------------------------------------------------------
+        /*! Get the sum of the little endian WORDs before the checksum
+        */
+        WORD getChecksum( void ) const
+        {
+          const BYTE *b   = (const BYTE *)this;
+          WORD        sum = 0;
+
+          for( BYTE i = 0; i < sizeof( Header ) - 2; i += 2 )
+          {
+            sum += b[i] | ( b[i + 1] << 8 );
+          }
+          return( sum );
+        }
+    };
+
+    //---------------------------------------------------------------
+    enum
+    {
+      SYNC          = 0x5353, //!< "SS"
+      VERSION       = 2,
+      CHANNEL_A     = 0x01,
+      CHANNEL_B     = 0x02,
+      RAW           = 0,      //!< Coding: samples as they are
+      RICE          = 1,      //!< Coding: see class Rice
+      BLOCK_SIZE    = 256,    //!< Samples per channel and block
+      NUM_OF_BLOCKS = 8
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a stream, stopped
+        \param channelMask  Channels to be sent, CHANNEL_A | CHANNEL_B
+        \param samplePeriod Sample period [us]
+        \param coding       RAW or RICE
+    */
+    Stream( BYTE channelMask, WORD samplePeriod, BYTE coding );
+
+    //---------------------------------------------------------------
+    /*! Start with an empty ring, sequence number 0. The restart is
+        applied by the next add() and getBlock(), see above.
+    */
+    void start( void );
+
+    //---------------------------------------------------------------
+    /*! Stop, a block being transmitted is finished by transmit()
+    */
+    void stop( void )
+    {
+      isRunning = false;
+    }
+
+    //---------------------------------------------------------------
+    bool isStarted( void ) const
+    {
+      return( isRunning );
+    }
+
+    //---------------------------------------------------------------
+    /*! The stream runs or full blocks are still to be transmitted,
+        e.g. the rest of a frame after stop(). The link must not be
+        used by others until this is false.
+    */
+    bool isBusy( void ) const
+    {
+      return( isRunning || tail != head );
+    }
+
+    //---------------------------------------------------------------
+    /*! Process the next sample of the acquisition
+        \param a Code of channel A
+        \param b Code of channel B
+    */
+    inline void add( WORD a, WORD b )
+    {
+      // start() since the last call, the block being filled is discarded
+      if( startCount != startRequest )
+      {
+        pos      = 0;
+        sequence = 0;
+        dropped  = 0;
+        first    = head;
+        __sync_synchronize(); // first is written before startCount
+        startCount = startRequest;
+      }
+
+      if( !isRunning )
+      {
+        return;
+      }
+
+      Block &blk = block[head];
+
+      if( channelMask & CHANNEL_A ) blk.sample[pos++] = a;
+      if( channelMask & CHANNEL_B ) blk.sample[pos++] = b;
+
+      if( pos >= blockWords )
+      {
+        pos                  = 0;
+        blk.header.sequence  = sequence++;
+        blk.header.dropped   = dropped;
+
+        BYTE next = ( head + 1 ) % NUM_OF_BLOCKS;
+        if( next != tail )
+        {
+          __sync_synchronize(); // samples are written before head
+          head = next;
+        }
+        else
+        {
+          dropped++;            // ring full, this block is reused
+        }
+      }
+    }
+
+    //---------------------------------------------------------------
+    /*! Pass the full blocks to a link, as far as it accepts them
+    */
+    void transmit( Link &link );
+
+    //---------------------------------------------------------------
+    /*! Get the oldest full block with its header. It stays valid
+        until releaseBlock().
+        \param size Number of bytes of header and samples
+        \return Block or 0, if there is none
+    */
+    const BYTE *getBlock( WORD &size );
+
+    //---------------------------------------------------------------
+    /*! Hand back the block of getBlock() after it has been sent
+    */
+    void releaseBlock( void );
+
+    //---------------------------------------------------------------
+    /*! Get the number of blocks dropped since start()
+    */
+    DWORD getDropped( void ) const
+    {
+      return( dropped );
+    }
+
+  private:
+    //---------------------------------------------------------------
+    class Block
+    {
+      public:
+        Header header;
+        WORD   sample[BLOCK_SIZE * 2];
+    };
+
+    //---------------------------------------------------------------
+    // Set the header fields, which are not set by add()
+    void setHeader( Header &header, BYTE coding, WORD dataSize );
+
+    //---------------------------------------------------------------
+    // Code the block into coded[]
+    void encode( const Block &blk );
+
+  private:
+    //---------------------------------------------------------------
+    BYTE           channelMask;
+    DWORD          sampleRate;
+    WORD           blockWords;  // samples of all channels per block
+    Block         *block;
+    BYTE           coding;
+    BYTE          *coded;       // header and coded samples of the tail block
+    WORD           codedSize;
+    bool           isCoded;     // coded[] holds the tail block
+
+    // written by add() only
+    volatile BYTE  head;        // block being filled
+    WORD           pos;
+    DWORD          sequence;
+    volatile DWORD dropped;
+    volatile BYTE  first;       // first block after the last start()
+    volatile BYTE  startCount;  // start() applied by add()
+
+    // written by transmit() only
+    volatile BYTE  tail;        // oldest full block
+    WORD           sent;        // bytes of the tail block already sent
+    BYTE           startAck;    // start() applied by getBlock()
+
+    // written by start() and stop() only
+    volatile BYTE  startRequest;
+    volatile bool  isRunning;
+
+}; //Stream
+
+#endif
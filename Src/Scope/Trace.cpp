@@ -0,0 +1,156 @@
+//*******************************************************************
+/*!
+\file   Trace.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Column based trace renderer for raw ADC captures
+*/
+
+//*******************************************************************
+#include "Trace.h"
+
+//*******************************************************************
+//
+// Trace::Scale
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Trace::Scale::Scale( const Window &window, const Calibration &calIn )
+{
+  cal      = calIn;
+  yTop     = window.y;
+  yBottom  = window.y + window.height;
+  mVBottom = window.mVBottom;
+  mVSpan   = window.mVTop - window.mVBottom;
+
+  if( mVSpan == 0 )
+  {
+    mVSpan = 1;
+  }
+}
+
+//-------------------------------------------------------------------
+WORD Trace::Scale::toY( WORD code ) const
+{
+  int mV = cal.toMilliVolt( code );
+  int y  = yBottom - (mV - mVBottom) * (yBottom - yTop) / mVSpan;
+
+  if( y < yTop    ) y = yTop;
+  if( y > yBottom ) y = yBottom;
+
+  return( y );
+}
+
+//-------------------------------------------------------------------
+int Trace::Scale::toMilliVolt( WORD y ) const
+{
+  if( yBottom == yTop )
+  {
+    return( mVBottom );
+  }
+  return( mVBottom + (yBottom - (int)y) * mVSpan / (yBottom - yTop) );
+}
+
+//*******************************************************************
+//
+// Trace
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Trace::Trace( ScreenGraphic &screenIn )
+
+: screen( screenIn )
+
+{
+}
+
+//-------------------------------------------------------------------
+void Trace::decimate( const volatile WORD *sample,
+                      WORD                 numOfSamples,
+                      Column              *column,
+                      WORD                 numOfColumns )
+{
+  if( numOfSamples == 0 )
+  {
+    return;
+  }
+
+  for( WORD c = 0; c < numOfColumns; c++ )
+  {
+    DWORD first = (DWORD) c      * numOfSamples / numOfColumns;
+    DWORD last  = (DWORD)(c + 1) * numOfSamples / numOfColumns;
+
+    if( last <= first )
+    {
+      last = first + 1; // less samples than columns
+    }
+
+    WORD min = sample[first];
+    WORD max = min;
+
+    for( DWORD i = first + 1; i < last; i++ )
+    {
+      WORD s = sample[i];
+      if( s < min ) min = s;
+      if( s > max ) max = s;
+    }
+    column[c].min = min;
+    column[c].max = max;
+  }
+}
+
+//-------------------------------------------------------------------
+void Trace::draw( const Column *column,
+                  WORD          numOfColumns,
+                  WORD          x,
+                  WORD          width,
+                  const Scale  &scale,
+                  WORD          color,
+                  const Region *clip )
+{
+  if( numOfColumns == 0 )
+  {
+    return;
+  }
+
+  WORD prevTop    = 0;
+  WORD prevBottom = 0;
+
+  for( WORD i = 0; i < width; i++ )
+  {
+    const Column &col = column[ (DWORD)i * numOfColumns / width ];
+
+    // higher codes are drawn further up, i.e. with lower y
+    WORD colTop    = scale.toY( col.max );
+    WORD colBottom = scale.toY( col.min );
+    WORD top       = colTop;
+    WORD bottom    = colBottom;
+
+    // connect to the previous column
+    if( i > 0 )
+    {
+      if( prevBottom < top    ) top    = prevBottom;
+      if( prevTop    > bottom ) bottom = prevTop;
+    }
+    prevTop    = colTop;
+    prevBottom = colBottom;
+
+    if(    clip
+        && (    x + i  < clip->x0 || x + i  > clip->x1
+             || bottom < clip->y0 || top    > clip->y1 ) )
+    {
+      continue;
+    }
+
+    if( top == bottom )
+    {
+      screen.drawPixel( x + i, top, color );
+    }
+    else
+    {
+      screen.drawLine( x + i, top, x + i, bottom, 1, color );
+    }
+  }
+}
+
+//EOF
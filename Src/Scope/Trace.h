@@ -0,0 +1,193 @@
+//*******************************************************************
+/*!
+\file   Trace.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Column based trace renderer for raw ADC captures
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_TRACE_H
+#define _SCOPE_TRACE_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+
+using namespace EmbSysLib::Hw;
+using namespace EmbSysLib::Dev;
+
+//*******************************************************************
+/*!
+\class Trace
+
+\brief Draws a capture as one vertical span per screen column
+
+A capture is first decimated into columns, each holding the min/max
+raw code of the samples mapped to it. Every column is then drawn as a
+single vertical line, which is connected to its neighbour. This needs
+one draw call per column instead of one per sample.
+*/
+class Trace
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Min/max of the raw codes mapped to one column
+    */
+    class Column
+    {
+      public:
+        WORD min;
+        WORD max;
+    };
+
+    //---------------------------------------------------------------
+    /*! Conversion of a raw code into the input voltage:
+        mV = offset + code * fullScale / 0x10000
+    */
+    class Calibration
+    {
+      public:
+        short offset;    //!< Input voltage at code 0 [mV]
+        WORD  fullScale; //!< Input voltage span of the ADC range [mV]
+
+        //-----------------------------------------------------------
+        /*! Get the input voltage [mV] of a raw code
+        */
+        int toMilliVolt( WORD code ) const
+        {
+          // code*fullScale < 2^32, so the conversion fits into 32 bit
+          return( offset + (int)(((DWORD)code * fullScale) >> 16) );
+        }
+
+        //-----------------------------------------------------------
+        /*! Get the raw code of an input voltage [mV], clipped to the
+            ADC range
+        */
+        WORD toCode( int mV ) const
+        {
+          if( mV <= offset )
+          {
+            return( 0 );
+          }
+          if( mV >= offset + (int)fullScale )
+          {
+            return( 0xFFFF );
+          }
+          return( ( (DWORD)( mV - offset ) << 16 ) / fullScale );
+        }
+    };
+
+    //---------------------------------------------------------------
+    /*! Screen area and the value and time span it shows
+    */
+    class Window
+    {
+      public:
+        WORD  x;        //!< Left border [px]
+        WORD  y;        //!< Top border [px]
+        WORD  width;    //!< Width [px]
+        WORD  height;   //!< Height [px]
+        int   mVTop;    //!< Voltage at top border [mV]
+        int   mVBottom; //!< Voltage at bottom border [mV]
+        DWORD duration; //!< Time span of the width [us]
+    };
+
+    //---------------------------------------------------------------
+    /*! Mapping of raw codes to y coordinates of a window
+    */
+    class Scale
+    {
+      public:
+        //-----------------------------------------------------------
+        /*! Instantiate the mapping
+            \param window Target window
+            \param cal    Calibration of the codes to be drawn
+        */
+        Scale( const Window &window, const Calibration &cal );
+
+        //-----------------------------------------------------------
+        /*! Get y coordinate of a raw code, clipped to the window
+        */
+        WORD toY( WORD code ) const;
+
+        //-----------------------------------------------------------
+        /*! Get the voltage [mV] at a y coordinate of the window
+        */
+        int toMilliVolt( WORD y ) const;
+
+      private:
+        //-----------------------------------------------------------
+        Calibration cal;
+        int         yTop;
+        int         yBottom;
+        int         mVBottom;
+        int         mVSpan;
+    };
+
+    //---------------------------------------------------------------
+    /*! Screen rectangle, borders included
+    */
+    class Region
+    {
+      public:
+        WORD x0;
+        WORD y0;
+        WORD x1;
+        WORD y1;
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a trace renderer
+        \param screen Target screen
+    */
+    Trace( ScreenGraphic &screen );
+
+    //---------------------------------------------------------------
+    /*! Decimate samples into columns. If there are less samples
+        than columns, samples are repeated.
+        \param sample       Raw samples
+        \param numOfSamples Number of samples
+        \param column       Destination
+        \param numOfColumns Number of columns
+    */
+    static void decimate( const volatile WORD *sample,
+                          WORD                 numOfSamples,
+                          Column              *column,
+                          WORD                 numOfColumns );
+
+    //---------------------------------------------------------------
+    /*! Draw columns as connected vertical spans. The columns are
+        stretched or compressed to the given width.
+        \param column       Columns to be drawn
+        \param numOfColumns Number of columns
+        \param x            Left border [px]
+        \param width        Width [px]
+        \param scale        Code to y mapping
+        \param color        Trace color
+        \param clip         If given, only spans touching this region
+                            are drawn, e.g. to repair an erased cursor
+    */
+    void draw( const Column *column,
+               WORD          numOfColumns,
+               WORD          x,
+               WORD          width,
+               const Scale  &scale,
+               WORD          color,
+               const Region *clip = 0 );
+
+    //---------------------------------------------------------------
+    /*! Get a dimmed (half bright) version of a color
+    */
+    static WORD dim( WORD color )
+    {
+      return( (color >> 1) & 0x7BEF ); // halve each of r, g and b
+    }
+
+  private:
+    //---------------------------------------------------------------
+    ScreenGraphic &screen;
+
+}; //Trace
+
+#endif
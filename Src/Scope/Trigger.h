@@ -0,0 +1,128 @@
+//*******************************************************************
+/*!
+\file   Trigger.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Edge trigger in the sample stream
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_TRIGGER_H
+#define _SCOPE_TRIGGER_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+
+//*******************************************************************
+/*!
+\class Trigger
+
+\brief Start of a capture at an edge of the signal
+
+arm() is called when a capture is restarted, then check() gets every
+sample of the trigger source in the timer interrupt until it returns
+true. This sample is the first one of the capture.
+
+An edge is detected, if the signal crosses the level after it has been
+HYSTERESIS codes on the other side of it, so noise at the level does
+not trigger on the wrong slope.
+
+Sweep:
+- FREE:   no trigger, the capture starts at once
+- AUTO:   start at an edge, or after the timeout without an edge
+- NORMAL: start at an edge only, waits forever
+*/
+class Trigger
+{
+  public:
+    //---------------------------------------------------------------
+    enum Slope
+    {
+      RISING = 0,
+      FALLING
+    };
+
+    //---------------------------------------------------------------
+    enum Sweep
+    {
+      FREE = 0,
+      AUTO,
+      NORMAL,
+      NUM_OF_SWEEPS
+    };
+
+    //---------------------------------------------------------------
+    enum
+    {
+      HYSTERESIS = 0x100 //!< [code]
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a trigger, FREE
+        \param timeoutIn Timeout of AUTO [samples]
+    */
+    Trigger( DWORD timeoutIn )
+    {
+      timeout = timeoutIn;
+      level   = 0x8000;
+      slope   = RISING;
+      sweep   = FREE;
+      arm();
+    }
+
+    //---------------------------------------------------------------
+    /*! Wait for the next edge
+    */
+    void arm( void )
+    {
+      isPrimed = false;
+      wait     = 0;
+    }
+
+    //---------------------------------------------------------------
+    /*! Process the next sample of the trigger source
+        \return true, if the capture starts with this sample
+    */
+    inline bool check( WORD code )
+    {
+      if( sweep == FREE )
+      {
+        return( true );
+      }
+
+      if( slope == RISING )
+      {
+        if( code + HYSTERESIS < level ) isPrimed = true;
+        else if( isPrimed && code >= level ) return( true );
+      }
+      else
+      {
+        if( code > level + HYSTERESIS ) isPrimed = true;
+        else if( isPrimed && code <= level ) return( true );
+      }
+      return( sweep == AUTO && ++wait >= timeout );
+    }
+
+    //---------------------------------------------------------------
+    void setLevel( WORD code ) { level = code;            }
+    void setSlope( BYTE s    ) { slope = ( s == FALLING ) ? FALLING : RISING; }
+    void setSweep( BYTE s    ) { sweep = ( s < NUM_OF_SWEEPS ) ? s : (BYTE)FREE; }
+
+    //---------------------------------------------------------------
+    WORD getLevel( void ) const { return( level ); }
+    BYTE getSlope( void ) const { return( slope ); }
+    BYTE getSweep( void ) const { return( sweep ); }
+
+  private:
+    //---------------------------------------------------------------
+    DWORD timeout;
+    DWORD wait;
+    WORD  level;
+    BYTE  slope;
+    BYTE  sweep;
+    bool  isPrimed;
+
+}; //Trigger
+
+#endif
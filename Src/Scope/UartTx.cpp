@@ -0,0 +1,130 @@
+//*******************************************************************
+/*!
+\file   UartTx.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Non-blocking UART transmission with a large ring buffer
+*/
+
+//*******************************************************************
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "UartTx.h"
+
+//*******************************************************************
+//
+// UartTx
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+UartTx::UartTx( Uart  &uartIn,
+                WORD   sizeIn,
+                DWORD  baudRate,
+                DWORD  cycleTime )
+
+: uart( uartIn )
+
+{
+  size      = sizeIn;
+  ring      = new BYTE[ size ];
+  head      = 0;
+  tail      = 0;
+  discarded = 0;
+  credit    = 0;
+
+  // 10 bit per byte (8N1), at 15/16 of the line rate
+  rate = (DWORD)( (unsigned long long)baudRate * cycleTime * 15 * 65536
+                  / ( 10ULL * 16 * 1000000 ) );
+}
+
+//-------------------------------------------------------------------
+WORD UartTx::set( const BYTE *data, WORD len )
+{
+  WORD n = getFree();
+
+  if( len > n )
+  {
+    discarded += len - n;
+    len        = n;
+  }
+
+  WORD h = head;
+  for( WORD i = 0; i < len; i++ )
+  {
+    ring[h] = data[i];
+    h       = ( h + 1 < size ) ? h + 1 : 0;
+  }
+
+  __sync_synchronize(); // data is written before head
+  head = h;
+
+  return( len );
+}
+
+//-------------------------------------------------------------------
+WORD UartTx::set( const char *str )
+{
+  return( set( (const BYTE *)str, strlen( str ) ) );
+}
+
+//-------------------------------------------------------------------
+WORD UartTx::printf( const char *format, ... )
+{
+  char    msg[PRINT_SIZE];
+  va_list args;
+
+  va_start( args, format );
+  int n = vsnprintf( msg, sizeof(msg), format, args );
+  va_end( args );
+
+  if( n <= 0 )
+  {
+    return( 0 );
+  }
+  if( n >= (int)sizeof(msg) )
+  {
+    n = sizeof(msg) - 1;
+  }
+  if( n > getFree() )
+  {
+    discarded += n;
+    return( 0 );
+  }
+  return( set( (const BYTE *)msg, n ) );
+}
+
+//-------------------------------------------------------------------
+WORD UartTx::getFree( void ) const
+{
+  WORD h = head;
+  WORD t = tail;
+
+  // one byte stays free, so a full ring differs from an empty one
+  return( ( t > h ) ? t - h - 1 : size - 1 - ( h - t ) );
+}
+
+//-------------------------------------------------------------------
+void UartTx::update( void )
+{
+  WORD t = tail;
+
+  if( t == head )
+  {
+    credit = 0; // idle, no burst after it
+    return;
+  }
+  __sync_synchronize(); // head is read before the data
+
+  credit += rate;
+  while( credit >= 0x10000 && t != head )
+  {
+    uart.set( ring[t] );
+    t       = ( t + 1 < size ) ? t + 1 : 0;
+    credit -= 0x10000;
+  }
+  tail = t;
+}
+
+//EOF
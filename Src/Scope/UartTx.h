@@ -0,0 +1,117 @@
+//*******************************************************************
+/*!
+\file   UartTx.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Non-blocking UART transmission with a large ring buffer
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_UART_TX_H
+#define _SCOPE_UART_TX_H
+
+//*******************************************************************
+#include "EmbSysLib.h"
+#include "Stream.h"
+
+using namespace EmbSysLib::Hw;
+
+//*******************************************************************
+/*!
+\class UartTx
+
+\brief Ring buffer in front of the transmit fifo of a UART
+
+The transmit fifo of Uart_Mcu is small and does not report its free
+space. set() never waits, it takes as much as fits into the ring and
+returns the number of bytes accepted. update() is called by a timer
+interrupt and passes the bytes at the line rate to the UART, whose
+transmit interrupt sends them. The fifo of the UART only has to
+buffer the bytes of a few timer periods.
+
+To be safe against a baud rate slightly below nominal, the ring is
+drained at 15/16 of the line rate. Without data no credit is saved,
+so a new message does not start with a burst into the fifo.
+
+One writer (the main loop) and one reader (update()), so no interrupt
+lock is needed. Also a Stream::Link, e.g. for the SCPI responses.
+*/
+class UartTx : public Stream::Link
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      PRINT_SIZE = 128 //!< Max. length of a printf() message
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a ring
+        \param uart      UART
+        \param size      Size of the ring [byte]
+        \param baudRate  Baud rate of the UART (8N1)
+        \param cycleTime Period of update() [us]
+    */
+    UartTx( Uart &uart, WORD size, DWORD baudRate, DWORD cycleTime );
+
+    //---------------------------------------------------------------
+    /*! Put data into the ring without waiting
+        \return Number of bytes accepted, 0 ... size
+    */
+    WORD set( const BYTE *data, WORD size );
+
+    //---------------------------------------------------------------
+    /*! Put a string into the ring without waiting
+        \return Number of characters accepted
+    */
+    WORD set( const char *str );
+
+    //---------------------------------------------------------------
+    /*! Put a formatted message (printf format) into the ring, either
+        completely or not at all, so no message is cut
+        \return Number of bytes accepted, 0 if the ring is too full
+    */
+    WORD printf( const char *format, ... );
+
+    //---------------------------------------------------------------
+    /*! Get the free space of the ring
+    */
+    WORD getFree( void ) const;
+
+    //---------------------------------------------------------------
+    /*! Get the number of bytes not accepted since the start
+    */
+    DWORD getDiscarded( void ) const
+    {
+      return( discarded );
+    }
+
+    //---------------------------------------------------------------
+    /*! Pass the bytes due to the UART, to be called by a timer
+        interrupt every cycleTime
+    */
+    void update( void );
+
+    //---------------------------------------------------------------
+    virtual WORD write( const BYTE *data, WORD size )
+    {
+      return( set( data, size ) );
+    }
+
+  private:
+    //---------------------------------------------------------------
+    Uart           &uart;
+    BYTE           *ring;
+    WORD            size;
+
+    volatile WORD   head;       // written by set() only
+    volatile WORD   tail;       // written by update() only
+    DWORD           discarded;
+
+    DWORD           rate;       // bytes per cycle, 16.16 fixed point
+    DWORD           credit;     // bytes allowed, 16.16 fixed point
+
+}; //UartTx
+
+#endif
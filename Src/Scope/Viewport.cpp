@@ -0,0 +1,158 @@
+//*******************************************************************
+/*!
+\file   Viewport.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Screen window showing a sample range of a capture
+*/
+
+//*******************************************************************
+#include "Viewport.h"
+
+//*******************************************************************
+//
+// Viewport
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Viewport::Viewport( ScreenGraphic &screenIn, const Trace::Window &windowIn )
+
+: screen( screenIn ),
+  trace ( screenIn )
+
+{
+  window       = windowIn;
+  base         = windowIn;
+  column       = new Trace::Column[ window.width ];
+  first        = 0;
+  numOfSamples = 0;
+  isDrawn      = false;
+}
+
+//-------------------------------------------------------------------
+void Viewport::setSpan( DWORD firstIn, DWORD numOfSamplesIn )
+{
+  first        = firstIn;
+  numOfSamples = numOfSamplesIn;
+  isDrawn      = false;
+}
+
+//-------------------------------------------------------------------
+void Viewport::setOffset( int mV )
+{
+  window.mVTop    = base.mVTop    - mV;
+  window.mVBottom = base.mVBottom - mV;
+}
+
+//-------------------------------------------------------------------
+void Viewport::setRange( int mVTop, int mVBottom )
+{
+  int mV = base.mVTop - window.mVTop;
+
+  base.mVTop    = mVTop;
+  base.mVBottom = mVBottom;
+  setOffset( mV );
+}
+
+//-------------------------------------------------------------------
+void Viewport::draw( const Pyramid            &pyramid,
+                     const Trace::Calibration &cal,
+                     WORD                      color )
+{
+  if( numOfSamples == 0 || pyramid.getNumOfSamples() == 0 )
+  {
+    return;
+  }
+
+  pyramid.decimate( first, numOfSamples, column, window.width );
+  isDrawn = true;
+
+  trace.draw( column,
+              window.width,
+              window.x,
+              window.width,
+              Trace::Scale( window, cal ),
+              color );
+}
+
+//-------------------------------------------------------------------
+void Viewport::redraw( const Trace::Region      &region,
+                       const Trace::Calibration &cal,
+                       WORD                      color )
+{
+  if( !isDrawn )
+  {
+    return;
+  }
+
+  trace.draw( column,
+              window.width,
+              window.x,
+              window.width,
+              Trace::Scale( window, cal ),
+              color,
+              &region );
+}
+
+//-------------------------------------------------------------------
+void Viewport::drawMarker( const Viewport &other, WORD color )
+{
+  WORD x0 = toX( other.first );
+  WORD x1 = toX( other.first + other.numOfSamples );
+  WORD y0 = window.y;
+  WORD y1 = window.y + window.height;
+
+  if( x1 > x0 )
+  {
+    x1--;
+  }
+
+  screen.drawLine( x0, y0, x1, y0, 1, color );
+  screen.drawLine( x0, y1, x1, y1, 1, color );
+  screen.drawLine( x0, y0, x0, y1, 1, color );
+  screen.drawLine( x1, y0, x1, y1, 1, color );
+}
+
+//-------------------------------------------------------------------
+void Viewport::drawFrame( WORD color )
+{
+  WORD x0 = window.x;
+  WORD x1 = window.x + window.width;
+  WORD y0 = window.y;
+  WORD y1 = window.y + window.height;
+
+  screen.drawLine( x0, y0, x1, y0, 1, color );
+  screen.drawLine( x0, y1, x1, y1, 1, color );
+  screen.drawLine( x0, y0, x0, y1, 1, color );
+  screen.drawLine( x1, y0, x1, y1, 1, color );
+}
+
+//-------------------------------------------------------------------
+WORD Viewport::toX( DWORD idx ) const
+{
+  if( idx <= first || numOfSamples == 0 )
+  {
+    return( window.x );
+  }
+  if( idx >= first + numOfSamples )
+  {
+    return( window.x + window.width );
+  }
+  return( window.x + (idx - first) * window.width / numOfSamples );
+}
+
+//-------------------------------------------------------------------
+DWORD Viewport::toIndex( WORD x ) const
+{
+  if( x <= window.x )
+  {
+    return( first );
+  }
+  if( x >= window.x + window.width )
+  {
+    return( first + numOfSamples );
+  }
+  return( first + (DWORD)(x - window.x) * numOfSamples / window.width );
+}
+
+//EOF
@@ -0,0 +1,148 @@
+//*******************************************************************
+/*!
+\file   Viewport.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Screen window showing a sample range of a capture
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_VIEWPORT_H
+#define _SCOPE_VIEWPORT_H
+
+//*******************************************************************
+#include "Trace.h"
+#include "Pyramid.h"
+
+//*******************************************************************
+/*!
+\class Viewport
+
+\brief Window with its own horizontal mapping onto a capture
+
+Several viewports can show different sample ranges of the same
+capture, e.g. an overview and a zoomed section. All of them are
+decimated from the same Pyramid, so each view only costs its own
+number of columns.
+
+\code
+  Viewport overview( screen, overviewWindow );
+  Viewport zoom    ( screen, zoomWindow );
+
+  pyramid.build( sample, numOfSamples );
+  overview.setSpan( 0,   numOfSamples );
+  zoom    .setSpan( 300, numOfSamples/4 );
+
+  overview.draw      ( pyramid, cal, Color::Yellow );
+  overview.drawMarker( zoom, Color::White );
+  zoom    .draw      ( pyramid, cal, Color::Yellow );
+\endcode
+*/
+class Viewport
+{
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a viewport
+        \param screen Target screen
+        \param window Screen area and voltage range
+    */
+    Viewport( ScreenGraphic &screen, const Trace::Window &window );
+
+    //---------------------------------------------------------------
+    /*! Set the sample range shown in the window
+        \param first        Index of the first sample
+        \param numOfSamples Number of samples
+    */
+    void setSpan( DWORD first, DWORD numOfSamples );
+
+    //---------------------------------------------------------------
+    /*! Shift the voltage range of the window
+        \param mV Offset [mV], positive values move the trace upwards
+    */
+    void setOffset( int mV );
+
+    //---------------------------------------------------------------
+    /*! Set the voltage range of the window, e.g. for another value
+        per div. The offset is kept.
+        \param mVTop    Voltage at top border [mV]
+        \param mVBottom Voltage at bottom border [mV]
+    */
+    void setRange( int mVTop, int mVBottom );
+
+    //---------------------------------------------------------------
+    /*! Draw the sample range
+        \param pyramid Pyramid of the capture
+        \param cal     Calibration of the capture
+        \param color   Trace color
+    */
+    void draw( const Pyramid            &pyramid,
+               const Trace::Calibration &cal,
+               WORD                      color );
+
+    //---------------------------------------------------------------
+    /*! Redraw the part of the trace touching a region, e.g. after a
+        cursor line has been erased. The columns of the last draw()
+        are reused, nothing is decimated again.
+        \param region Screen region
+        \param cal    Calibration of the capture
+        \param color  Trace color
+    */
+    void redraw( const Trace::Region      &region,
+                 const Trace::Calibration &cal,
+                 WORD                      color );
+
+    //---------------------------------------------------------------
+    /*! Draw a box marking the sample range of another viewport
+        \param other Viewport, typically the zoom window
+        \param color Color of the box
+    */
+    void drawMarker( const Viewport &other, WORD color );
+
+    //---------------------------------------------------------------
+    /*! Draw a frame around the window
+    */
+    void drawFrame( WORD color );
+
+    //---------------------------------------------------------------
+    /*! Get the x coordinate of a sample index, clipped to the window
+    */
+    WORD toX( DWORD idx ) const;
+
+    //---------------------------------------------------------------
+    /*! Get the sample index at an x coordinate
+    */
+    DWORD toIndex( WORD x ) const;
+
+    //---------------------------------------------------------------
+    const Trace::Window &getWindow( void ) const
+    {
+      return( window );
+    }
+
+    //---------------------------------------------------------------
+    DWORD getFirst( void ) const
+    {
+      return( first );
+    }
+
+    //---------------------------------------------------------------
+    DWORD getNumOfSamples( void ) const
+    {
+      return( numOfSamples );
+    }
+
+  private:
+    //---------------------------------------------------------------
+    ScreenGraphic  &screen;
+    Trace           trace;
+    Trace::Window   window;
+    Trace::Window   base;    // window without offset
+    Trace::Column  *column;
+
+    DWORD           first;
+    DWORD           numOfSamples;
+    bool            isDrawn; // column holds the actual span
+
+}; //Viewport
+
+#endif
@@ -0,0 +1,147 @@
+//*******************************************************************
+/*!
+\file   Waterfall.cpp
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Spectrogram of consecutive FFT frames
+*/
+
+//*******************************************************************
+#include "Waterfall.h"
+#include "../Resource/Color/Color.h"
+
+//*******************************************************************
+//
+// Waterfall
+//
+//*******************************************************************
+//-------------------------------------------------------------------
+Waterfall::Waterfall( ScreenGraphic       &screenIn,
+                      const Fft           &fftIn,
+                      const Trace::Window &windowIn )
+
+: screen( screenIn ),
+  fft   ( fftIn )
+
+{
+  window = windowIn;
+
+  // piecewise linear from black over blue, cyan, green, yellow and
+  // red to white. Entry 0 is black, so the noise floor stays dark
+  static const BYTE node[7][3] =
+  {
+    {   0,   0,   0 },
+    {   0,   0, 255 },
+    {   0, 255, 255 },
+    {   0, 255,   0 },
+    { 255, 255,   0 },
+    { 255,   0,   0 },
+    { 255, 255, 255 }
+  };
+
+  for( WORD i = 0; i < NUM_OF_COLORS; i++ )
+  {
+    DWORD pos  = (DWORD)i * 6 * 256 / ( NUM_OF_COLORS - 1 ); // 8 bit fraction
+    WORD  n    = pos >> 8;
+    int   frac = pos & 0xFF;
+
+    if( n >= 6 )
+    {
+      n    = 5;
+      frac = 256;
+    }
+
+    int c[3];
+    for( BYTE k = 0; k < 3; k++ )
+    {
+      c[k] = node[n][k] + ( ( node[n + 1][k] - node[n][k] ) * frac >> 8 );
+    }
+    palette[i] = Color::rgb( c[0], c[1], c[2] );
+  }
+
+  row       = 0;
+  numOfRows = 0;
+}
+
+//-------------------------------------------------------------------
+void Waterfall::clear( void )
+{
+  for( WORD y = 0; y < window.height; y++ )
+  {
+    screen.drawLine( window.x,                    window.y + y,
+                     window.x + window.width - 1, window.y + y, 1, palette[0] );
+  }
+  row       = 0;
+  numOfRows = 0;
+}
+
+//-------------------------------------------------------------------
+WORD Waterfall::getColor( int dB ) const
+{
+  int i = ( dB + Spectrum::DB_RANGE ) * ( NUM_OF_COLORS - 1 ) / Spectrum::DB_RANGE;
+
+  if( i < 0 )                  i = 0;
+  if( i > NUM_OF_COLORS - 1 )  i = NUM_OF_COLORS - 1;
+
+  return( palette[i] );
+}
+
+//-------------------------------------------------------------------
+void Waterfall::add( WORD markerColor )
+{
+  if( window.height < 2 )
+  {
+    return;
+  }
+
+  DWORD numOfBins = fft.getSize() / 2;   // bin 1 ... size/2, DC is removed
+  WORD  y         = window.y + row;
+
+  // columns of the same color are drawn as one line
+  WORD  runStart = window.x;
+  WORD  runColor = 0;
+  DWORD bin      = 1;
+
+  for( WORD c = 0; c < window.width; c++ )
+  {
+    DWORD last = ( (DWORD)( c + 1 ) * numOfBins ) / window.width;
+    if( last < bin )
+    {
+      last = bin;
+    }
+
+    int dB = -Spectrum::DB_RANGE;
+    for( DWORD k = bin; k <= last && k <= numOfBins; k++ )
+    {
+      int level = fft.getDeciBel( k );
+      if( level > dB )
+      {
+        dB = level;
+      }
+    }
+    bin = last + 1;
+
+    WORD color = getColor( dB );
+
+    if( c == 0 )
+    {
+      runColor = color;
+    }
+    else if( color != runColor )
+    {
+      screen.drawLine( runStart, y, window.x + c - 1, y, 1, runColor );
+      runStart = window.x + c;
+      runColor = color;
+    }
+  }
+  screen.drawLine( runStart, y, window.x + window.width - 1, y, 1, runColor );
+
+  // circular row offset, the marker is overwritten by the next row
+  row = ( row + 1 ) % ( window.height - 1 );
+  numOfRows++;
+
+  screen.drawLine( window.x,                    window.y + row,
+                   window.x + window.width - 1, window.y + row, 1, markerColor );
+}
+
+//EOF
@@ -0,0 +1,91 @@
+//*******************************************************************
+/*!
+\file   Waterfall.h
+\author Len-Marvin Adler
+\date   18.10.2026
+\brief  Spectrogram of consecutive FFT frames
+*/
+
+//*******************************************************************
+#ifndef _SCOPE_WATERFALL_H
+#define _SCOPE_WATERFALL_H
+
+//*******************************************************************
+#include "Trace.h"
+#include "Fft.h"
+#include "Spectrum.h"
+
+//*******************************************************************
+/*!
+\class Waterfall
+
+\brief Draws every FFT frame as one row of colored pixels
+
+The columns are mapped onto the bins like in Spectrum (maximum of the
+bins of a column), the level from -Spectrum::DB_RANGE to 0 dBFS is
+mapped onto a palette of NUM_OF_COLORS colors, dark blue to white.
+
+A new row is written at a circular row offset: the row below the last
+one, wrapping from the bottom to the top of the window. A marker line
+shows the newest row. So a frame costs one row of pixels, nothing is
+redrawn or copied, however long the waterfall runs. The rows are not
+stored, clear() starts an empty waterfall at the top.
+*/
+class Waterfall
+{
+  public:
+    //---------------------------------------------------------------
+    enum
+    {
+      NUM_OF_COLORS = 64
+    };
+
+  public:
+    //---------------------------------------------------------------
+    /*! Instantiate a waterfall
+        \param screen Target screen
+        \param fft    Transform to be shown
+        \param window Screen area (the voltage range is not used)
+    */
+    Waterfall( ScreenGraphic       &screen,
+               const Fft           &fft,
+               const Trace::Window &window );
+
+    //---------------------------------------------------------------
+    /*! Clear the window and start again at the top row
+    */
+    void clear( void );
+
+    //---------------------------------------------------------------
+    /*! Draw the last transform as next row
+        \param markerColor Color of the line below the newest row
+    */
+    void add( WORD markerColor );
+
+    //---------------------------------------------------------------
+    /*! Get the number of rows drawn since clear()
+    */
+    DWORD getNumOfRows( void ) const
+    {
+      return( numOfRows );
+    }
+
+    //---------------------------------------------------------------
+    /*! Get the palette color of a level
+        \param dB Level [0.1 dBFS]
+    */
+    WORD getColor( int dB ) const;
+
+  private:
+    //---------------------------------------------------------------
+    ScreenGraphic &screen;
+    const Fft     &fft;
+    Trace::Window  window;
+
+    WORD           palette[NUM_OF_COLORS];
+    WORD           row;        // y offset of the next row in the window
+    DWORD          numOfRows;
+
+}; //Waterfall
+
+#endif
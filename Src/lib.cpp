@@ -16,3 +16,27 @@ This file is used to avoid modifications in the IDE project file
 #include "Module/USB/USB_Uart.cpp"
 #include "Module/USB/USBinterfClassHID.cpp"
 #include "Module/USB/USBdeviceSimpleIO.cpp"
+
+#include "Scope/Trace.cpp"
+#include "Scope/Reference.cpp"
+#include "Scope/PackedResource.cpp"
+#include "Scope/Pyramid.cpp"
+#include "Scope/Viewport.cpp"
+#include "Scope/Cursors.cpp"
+#include "Scope/Gesture.cpp"
+#include "Scope/Fft.cpp"
+#include "Scope/Spectrum.cpp"
+#include "Scope/Waterfall.cpp"
+#include "Scope/Measure.cpp"
+#include "Scope/Filter.cpp"
+#include "Scope/Counter.cpp"
+#include "Scope/MathChannel.cpp"
+#include "Scope/Decoder.cpp"
+#include "Scope/Mask.cpp"
+#include "Scope/Histogram.cpp"
+#include "Scope/Interpolator.cpp"
+#include "Scope/Rice.cpp"
+#include "Scope/Stream.cpp"
+#include "Scope/Scpi.cpp"
+#include "Scope/Screenshot.cpp"
+#include "Scope/UartTx.cpp"
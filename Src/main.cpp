@@ -15,37 +15,72 @@
 #include "ReportHandler.h"
 #include "config.h"
 
+#include "Scope/Layout.h"
+#include "Scope/Trace.h"
+#include "Scope/Reference.h"
+#include "Scope/Pyramid.h"
+#include "Scope/Viewport.h"
+#include "Scope/Cursors.h"
+#include "Scope/Gesture.h"
+#include "Scope/Fft.h"
+#include "Scope/Spectrum.h"
+#include "Scope/Waterfall.h"
+#include "Scope/Measure.h"
+#include "Scope/Filter.h"
+#include "Scope/Counter.h"
+#include "Scope/MathChannel.h"
+#include "Scope/Decoder.h"
+#include "Scope/Mask.h"
+#include "Scope/Histogram.h"
+#include "Scope/Interpolator.h"
+#include "Scope/Stream.h"
+#include "Scope/Trigger.h"
+#include "Scope/Scpi.h"
+#include "Scope/UartTx.h"
+#ifdef USB_DEVICE_ENABLE
+  #if USE_USB_STREAM == 'C'
+    #include "Scope/CdcLink.h"
+  #else
+    #include "Scope/BulkLink.h"
+  #endif
+#endif
+
 
 //-------------------------------------------------------------------
-const int xmax = screen.getWidth()  - 1;
-const int ymax = screen.getHeight() - 1;
+// selectable scaling of the axes
+typedef DivTable<1000, 2000, 500, 200> VoltPerDiv;	// mV/div
+typedef DivTable<7900> TimePerDiv;					// µs/div, 79px/div => 100µs per sample
+
+// the whole geometry is computed at compile time from the panel size,
+// a layout not giving integer scaling is rejected by the compiler
+typedef Layout<DISPLAY_WIDTH, DISPLAY_HEIGHT, VoltPerDiv, TimePerDiv> ScreenLayout;
+
+BYTE vdiv = 0;			// index into VoltPerDiv, can be changed by the remote control
+const BYTE tdiv = 0;	// index into TimePerDiv
+
+const int xmax = ScreenLayout::xmax;
+const int ymax = ScreenLayout::ymax;
 
 //-------------------------------------------------------------------
-// y-axis will be labeled from -15 to +15
-// that makes 30 different labels to display
-const int voltmin = -5;
-const int voltmax = 5;
-const int numOfVoltLabels = abs(voltmax) + abs(voltmin);
-const int pixelPerVolt = ymax / numOfVoltLabels;
-const int onlyLabelEvery = 2; //voltmax / 7.5;	// only label every onlyLabelEvery times, (every 2 times)
+// y-axis will be labeled from voltmin to voltmax, at the initial volts per div
+const int voltmin = ScreenLayout::mVBottom(0);	// mV
+const int voltmax = ScreenLayout::mVTop(0);		// mV
+const int onlyLabelEvery = 2;	// only label every onlyLabelEvery times, (every 2 times)
 
 // voltages at gpio pin
 const int gpio_vmin = 0;
 const float gpio_vmax = 3.3;
 
+// voltage divider in front of the gpio pin, see paper section 4.3
+const float r1 = 230;	// ohm
+const float r2 = 100;	// ohm
+const float u_offset = 5;	// voltage added to input voltage via opamp
 
-//-------------------------------------------------------------------
-// how many seconds to fit on whole display
-const int secondsToDisplay = 10;	// display 10 time values, evenly spaced on x-axis
-const float pixelPerSecond = xmax / secondsToDisplay;
 
-// how many x-pixels until the next sample value to draw
-// 1000 values per 100µs => 100µs * 1000 = 100*10⁻⁶*1000 = 0.1s für 1000 Werte
-// => 1s für 10*1000 = 10000 Werte
-//#define SAMPLESPERSECOND (SAMPLESIZE * 0.0001 * 100 * 10)
-//const float nextSampleTime = (pixelPerSecond / SAMPLESPERSECOND);
-const int firstLabel = xmax/2 - (secondsToDisplay/2) * pixelPerSecond;	// x coord of first label of time axis
-const int lastLabel = firstLabel + secondsToDisplay * pixelPerSecond;	// x coord of last label of time axis
+//-------------------------------------------------------------------
+// x coord of first and last label of time axis
+const int firstLabel = ScreenLayout::firstLabel;
+const int lastLabel = ScreenLayout::lastLabel;
 
 
 //-------------------------------------------------------------------
@@ -55,73 +90,241 @@ const int lastLabel = firstLabel + secondsToDisplay * pixelPerSecond;	// x coord
 // but only store values until (lastLabel - firstLabel)
 // this way VLA can be avoided
 #define SAMPLESIZEMAX 800 //(799 - 2*4);
-const int sampleSize = lastLabel - firstLabel;
+const int sampleSize = ScreenLayout::sampleSize;
+static_assert(sampleSize <= SAMPLESIZEMAX, "layout needs more samples than SAMPLESIZEMAX");
 // 799px on display, 4px margin left and margin right
 // you can only display one value per pixel
-volatile float volts[SAMPLESIZEMAX] = {0};
+// raw 16-bit ADC codes, converted to voltage only when drawn
+volatile WORD volts[SAMPLESIZEMAX] = {0};
+volatile WORD voltsB[SAMPLESIZEMAX] = {0};	// channel B, same time base, input of the math channel
 volatile bool voltsVoll = false;
 volatile int voltCount = 0;
 
-/// get Voltage at GPIO Pin
+/// conversion of raw ADC codes into input voltage
 ///
-/// @returns voltage measured at GPIO/ADC A1
-/// between 0V and 3.3V
-float getADCVolt(void)
-{
-	// 16-Bit IDR register
-	return (adc.get(adc_A1) * gpio_vmax) / (unsigned)0xFFFF;
-}
+/// u_in = code/0x10000 * gpio_vmax * (r1 + r2)/r2 - u_offset
+const Trace::Calibration calibration = {
+	(short)(-u_offset * 1000),					// mV at code 0
+	(WORD)(gpio_vmax * (r1 + r2) / r2 * 1000)	// mV of full ADC range
+};
 
-/// get input voltage from voltage measured at gpio pin
-///
-/// does what is described in our paper in section 4.3
-/// @param gpio_volt voltage measured by ADC1 GPIO Pin
-/// @param u_offset voltage that got added to input voltage via opamp
-float getInputVoltage(float gpio_volt, float u_offset)
-{
-	float r1 = 230;	// ohm
-	float r2 = 100;	// ohm
-	float u_vorst = gpio_volt * (r1 + r2) / (float)r2;
-	return u_vorst - u_offset;
-}
+// sample period of MyTimer in µs
+const WORD samplePeriod = 100;
+static_assert(ScreenLayout::samplePeriod(tdiv) == samplePeriod, "time/div does not match MyTimer");
+
+// a capture starts at an edge of channel A, free running by default
+// AUTO starts without an edge after the time of one capture
+Trigger trigger(sampleSize);
 
 // how many 100th µs have elapsed since starting a measure
 // if this is >= 50000, so 5s then stop restarting measurement and just print the measured sample
 
+bool isWaveformSent(void);
+bool restartPending = false;	// restart deferred until the waveform is sent
+
 /// restarts measuring a sample
 ///
 /// so take a new sample
+/// :WAV:DATA? sends directly from the capture, while it is sent the capture is kept
+/// and the restart is done by the main loop afterwards
 void restartMeasurement(int &time)
 {
+	if (isWaveformSent()) {
+		restartPending = true;
+		return;
+	}
+	restartPending = false;
 	voltCount = 0;
 	voltsVoll = false;
 	time = 0;
+	trigger.arm();
 }
 
 
 
 //-------------------------------------------------------------------
-/// get y coordinate from measured voltage
+/// screen area of the trace, from voltmax to voltmin and firstLabel to lastLabel
+/// the voltage range follows the volts per div, see setVoltPerDiv()
+Trace::Window traceWindow = {
+	ScreenLayout::firstLabel, ScreenLayout::yTop,
+	ScreenLayout::sampleSize, ScreenLayout::yBottom - ScreenLayout::yTop,
+	voltmax, voltmin,
+	(DWORD)sampleSize * samplePeriod
+};
+
+Trace trace(screen);
+
+// golden captures, stored in non-volatile memory
+Reference reference(mem);
+const WORD referenceColor[Reference::NUM_OF_SLOTS] = {
+	Color::Cyan, Color::Magenta, Color::Green, Color::White
+};
+int nextReferenceSlot = 0;
+
+/// draws all valid reference slots as dimmed overlay
 ///
-/// @param volt The measured voltage
-/// @param pixelPerVolt The scaling, how many pixel will be needed to draw 0V to 1V, etc.
-/// @returns Corresponding Y-Coordinate to draw on screen
-int yCoordFromVolt(double volt, int pixelPerVolt)
+/// with clip only the parts touching this region are drawn
+void drawReferences(const Trace::Region *clip = 0)
 {
-	// volt außerhalb der erlaubten [voltmin, voltmax]
-	if (volt > voltmax) {
-		volt = voltmax;
+	for (int slot=0; slot<Reference::NUM_OF_SLOTS; slot++) {
+		reference.draw(trace, slot, traceWindow, referenceColor[slot], clip);
 	}
-	if (volt < voltmin) {
-		volt = voltmin;
-	}
-	// pixel on screen is volt * pixelPerVolt
-	// because pixelPerVolt is amount of pixel needed for 1V
-	// 0V to 15V is ymax/2 to 0px
-	return (int) (ymax/2 - volt * pixelPerVolt);
 }
 
 
+//-------------------------------------------------------------------
+// split screen: overview of the whole capture on top, zoomed section below
+// both are decimated from the same pyramid, built once per capture
+const int splitGap = 24;	// px between overview and zoom, room for the zoom label
+
+Trace::Window overviewWindow = {
+	ScreenLayout::firstLabel, ScreenLayout::yTop,
+	ScreenLayout::sampleSize, ScreenLayout::yCenter - ScreenLayout::yTop - splitGap/2,
+	voltmax, voltmin,
+	(DWORD)sampleSize * samplePeriod
+};
+
+Trace::Window zoomWindow = {
+	ScreenLayout::firstLabel, ScreenLayout::yCenter + splitGap/2,
+	ScreenLayout::sampleSize, ScreenLayout::yBottom - ScreenLayout::yCenter - splitGap/2,
+	voltmax, voltmin,
+	(DWORD)sampleSize * samplePeriod
+};
+
+Trace::Column pyramidStorage[SAMPLESIZEMAX];
+Pyramid pyramid(pyramidStorage, SAMPLESIZEMAX);
+
+Viewport mainView(screen, traceWindow);
+Viewport overview(screen, overviewWindow);
+Viewport zoomView(screen, zoomWindow);
+
+// reconstruction of the zoom window, if it shows less samples than pixel columns
+// computed once per capture and zoom, the detail viewport shows one point per column
+const BYTE interpolation = Interpolator::SINC;
+Interpolator interpolator(ScreenLayout::sampleSize);
+Trace::Column detailPyramidStorage[SAMPLESIZEMAX];
+Pyramid detailPyramid(detailPyramidStorage, SAMPLESIZEMAX);
+Viewport detailView(screen, zoomWindow);
+
+/// views, btnCtrl switches to the next one
+enum ViewMode {
+	VIEW_TRACE = 0,		// full screen trace with cursors
+	VIEW_SPLIT,			// overview + zoom with gestures
+	VIEW_SPECTRUM,		// FFT magnitude
+	VIEW_WATERFALL,		// FFT magnitude of every capture as colored row
+	VIEW_MATH,			// full screen trace with math channel
+	VIEW_DECODE,		// event table of the serial decoder
+	VIEW_MASK,			// pass/fail test of every capture
+	VIEW_HISTOGRAM,		// amplitude and edge time histograms of many captures
+	NUM_OF_VIEWS
+};
+int viewMode = VIEW_TRACE;
+
+int zoomFactor = 4;			// samples of the capture / samples in the zoom window
+int zoomCenter = sampleSize/2;	// sample index in the middle of the zoom window
+const int zoomFactorMax = 32;
+int verticalOffset = 0;		// mV, shifts the traces of the split screen upwards
+
+// pinch, drag and swipe in the split screen view
+Gesture gesture;
+
+// two time and two voltage cursors in the full screen view, dragged by touch
+// the readout is placed in the upper right quarter
+Cursors cursors(screen, mainView, samplePeriod, calibration,
+                ScreenLayout::xCenter + 20, 10,
+                Color::LightGrey, Color::DarkCyan, Color::Black);
+
+// spectrum of the first fftSize samples of the capture, computed once per capture
+// btnLeft selects the window function in this view
+const WORD fftSize = 512;
+static_assert(fftSize <= sampleSize, "capture is shorter than the FFT");
+Fft fft(fftSize);
+Spectrum spectrum(screen, fft);
+const int dBPerDiv = 200;	// 0.1 dB
+
+// spectrogram, one row per capture, captures are taken continuously in this view
+// btnLeft selects the window function in this view, too
+// the rows start below the header text, they would erase it otherwise
+const WORD waterfallTop = 40;
+Trace::Window waterfallWindow = {
+	ScreenLayout::firstLabel, waterfallTop,
+	ScreenLayout::sampleSize, ScreenLayout::yBottom - waterfallTop,
+	voltmax, voltmin,
+	(DWORD)sampleSize * samplePeriod
+};
+Waterfall waterfall(screen, fft, waterfallWindow);
+
+// optional filter stage between acquisition and display, applied in place once per capture
+Fir firFilter(31, 100);			// 31 taps, cutoff fs/10
+Biquad iirFilter(2, 50);		// 4th order Butterworth, cutoff fs/20
+MovingAverage averageFilter(8);	// 8 samples
+Filter *const filterTable[] = { 0, &firFilter, &iirFilter, &averageFilter };
+const BYTE filterSel = 0;	// index into filterTable, 0: unfiltered
+
+// automatic measurements, one pass per capture, shown below the time range
+Measure measure(calibration, samplePeriod);
+
+// reciprocal frequency counter, fed with every sample, also between captures
+// a gate of 1s resolves about 1mHz at 100Hz
+const DWORD counterGate = 10000;	// samples, 1s
+Counter counter(samplePeriod, counterGate);
+Counter::Result counterResult = {0, 0, 0};
+
+// every sample of both channels as framed binary blocks to the host, also between captures
+// CDC: started by the remote control (:STReam ON), stopped at disconnect, sent by the main loop
+// bulk: started by the host, sent by the USB interrupt
+// the samples are coded losslessly (delta and Rice code), about half the bytes of raw samples
+Stream stream(Stream::CHANNEL_A | Stream::CHANNEL_B, samplePeriod, Stream::RICE);
+#if defined(USB_DEVICE_ENABLE) && USE_USB_STREAM == 'C'
+// the host takes at least one packet per USB frame (1ms), the stream needs 40kB/s uncoded
+CdcLink cdcLink(usbUart, 4096, 64000, taskManager.getCycleTime());	// fifo size of usbUart
+#elif defined(USB_DEVICE_ENABLE)
+BulkLink bulkLink(usb, 0, stream);
+#endif
+
+// math channel of A and B with its own scale, computed only when the math view is shown
+// btnLeft selects the operation in this view
+MathChannel math(calibration, samplePeriod, SAMPLESIZEMAX);
+
+// the result spans the whole window, code 0x8000 is the center line
+const Trace::Calibration mathCalibration = { -32768, 0xFFFF };
+const Trace::Window mathWindow = {
+	ScreenLayout::firstLabel, ScreenLayout::yTop,
+	ScreenLayout::sampleSize, ScreenLayout::yBottom - ScreenLayout::yTop,
+	32767, -32768,
+	(DWORD)sampleSize * samplePeriod
+};
+Trace::Column mathPyramidStorage[SAMPLESIZEMAX];
+Pyramid mathPyramid(mathPyramidStorage, SAMPLESIZEMAX);
+Viewport mathView(screen, mathWindow);
+
+// serial decoder of channel A (and B), decoded once per capture
+// btnLeft selects the protocol in the decoder view, the table starts at the zoom window
+// the annotations are shown below the zoom window of the split screen
+const DWORD uartBaud = 1200;		// at least 3 samples per bit
+const int logicThreshold = 1650;	// mV
+Decoder decoder(calibration, samplePeriod, 256);
+
+// mask test, stored in maskMem of the board, behind the reference slots if it is the same memory
+// btnLeft creates the mask from the shown capture in the mask view, then every capture is tested
+const int maskTolerance = 200;		// mV
+const BYTE maskTimeTolerance = 1;	// mask points, 1 point = sampleSize/200 samples
+const bool maskStopOnFail = true;	// keep a failed capture on screen, btnRight continues
+Mask mask(maskMem, (&maskMem == &mem) ? Reference::MEMORY_SIZE : 0, sampleSize);
+
+// histograms accumulated over all captures while the histogram view is shown
+// the amplitude panel is aligned to the voltage axis, the edge time panel is at the bottom
+// btnLeft clears them
+Histogram histogram(calibration, samplePeriod);
+const WORD histogramWidth = 120;	// px, amplitude panel at the right border
+const Trace::Region histogramTimeArea = {
+	ScreenLayout::firstLabel, ScreenLayout::yBottom - 80,
+	ScreenLayout::lastLabel - histogramWidth - 10, ScreenLayout::yBottom
+};
+
+// output to the UART without waiting, the ring is passed to the UART by MyTimer at the line rate
+UartTx uartTx(uart, 4096, UART_BAUD_RATE, taskManager.getCycleTime());
+
 /// Timer needed for using RTC, Timer Interrupt
 class MyTimer : TaskManager::Task
 {
@@ -133,19 +336,40 @@ public:
 		tm.add(this);
 	}
 
+	/// timer interrupt, every 100µs
+	///
+	/// a replay as fast as possible (USE_ADC 'F') is driven by the main loop instead
+	void update()
+	{
+#if !defined(USE_ADC) || USE_ADC != 'F'
+		acquire();
+#endif
+		uartTx.update();
+#if defined(USB_DEVICE_ENABLE) && USE_USB_STREAM == 'C'
+		cdcLink.update();
+#endif
+	}
+
 	/// get new ADC measurement
 	///
-	/// will be called every 100µs
+	/// will be called every 100µs by update()
 	/// and pulls a new measurement by ADC from it's 12 Bit register
 	/// zieht Werte mit Frequenz 10kHz
-	void update()
+	/// only the raw code is stored, conversion is done while drawing
+	/// the counter and the stream get every sample, a capture only until it is full
+	/// and only after the trigger
+	void acquire()
 	{
 		// measure every 100µs
 		// 100µs defined in config.h l.130
 		time++;
-		if (!voltsVoll) {
-			// U_offset is 5V
-			volts[voltCount++] = getInputVoltage(getADCVolt(), 5);
+		WORD code = adc.get(adc_A1);
+		WORD codeB = adc.get(adc_A2);
+		counter.add(code);
+		stream.add(code, codeB);
+		if (!voltsVoll && (voltCount > 0 || trigger.check(code))) {
+			voltsB[voltCount] = codeB;
+			volts[voltCount++] = code;
 			if (voltCount == sampleSize) {
 				voltsVoll = true;
 			}
@@ -154,78 +378,551 @@ public:
 };
 
 
-#define DASHBREITE 10
+/// prints a value given in 1/1000 units (mV, µs) with one decimal
+/// if it isn't a whole number
+void drawMilliValue(int x, int y, int value)
+{
+	if (value % 1000 == 0) {
+		screen.drawText(x, y, "%3d", value / 1000);
+	} else {
+		int tenth = abs(value / 100) % 10;
+		screen.drawText(x, y, "%s%d.%d", value < 0 ? "-" : "", abs(value / 1000), tenth);
+	}
+}
+
+/// checks if the rectangle x0,y0 .. x1,y1 touches the clip region
+///
+/// without clip region everything is touched
+bool touches(const Trace::Region *clip, int x0, int y0, int x1, int y1)
+{
+	return !clip || (x1 >= clip->x0 && x0 <= clip->x1 && y1 >= clip->y0 && y0 <= clip->y1);
+}
+
 /// draws the coordinate system on screen
 ///
 /// Draws the time (horizontal) axis
 /// and voltage (vertical) axis on screen
 /// with scaling (labels/values)
-/// @param pixelPerVolt The distance from 1 label on Y-Axis to another, so how many pixel are inbetween the labels of Volt
-/// @param pixelPerSecond The distance from 1 label on X-Axis to another, so how many pixel are inbetween the labels of Time
-void drawCoordinateSystem(int pixelPerVolt, int pixelPerSecond)
+/// all tick and label positions are taken from the compile time ScreenLayout
+/// with clip only the parts touching this region are drawn, e.g. below an erased cursor
+void drawCoordinateSystem(const Trace::Region *clip = 0)
 {
+	  const int dash = ScreenLayout::dashWidth;
+	  const int labelWidth = 50;	// px, enough for "-2.5"
+	  const int labelHeight = 20;	// px, Font_10x20
+
 	  // draw y-achse und Beschriftungen U fuer Voltage
-	  screen.drawLine( xmax/2,      0, xmax/2, ymax  , 1, Color::Red ); // vertikal
-	  // then the rest
-	  // 10 pixel dash
+	  if (touches(clip, ScreenLayout::xCenter, 0, ScreenLayout::xCenter, ymax))
+		  screen.drawLine( ScreenLayout::xCenter, 0, ScreenLayout::xCenter, ymax, 1, Color::Red ); // vertikal
 
 	  // ---vertical axis---
-	  // ueber der 0 muessen 15mal beschriftet werden
-	  // distance from current label to next on
 	  // dash ist '-' auf der Achse an dem Beschriftung liegt
-	  //int dashBreite = 10;
-	  int label = 0;
-	  for (int y=ymax/2; y>=0; y-=pixelPerVolt) {
-		  int dashStart = xmax/2 - DASHBREITE/2;
-		  int dashEnd = xmax/2 + DASHBREITE/2;
-		  // draw beschriftung at x=0-haelfte der breite, y
-		  screen.drawLine(dashStart, y, dashEnd, y, 1, Color::Red);
+	  for (int i=0; i<ScreenLayout::yTick.size; i++) {
+		  int y = ScreenLayout::yTick[i];
+		  int tick = ScreenLayout::divY/2 - i;	// +5 at top, -5 at bottom
+		  if (touches(clip, ScreenLayout::xCenter - dash/2, y, ScreenLayout::xCenter + dash/2, y))
+			  screen.drawLine(ScreenLayout::xCenter - dash/2, y, ScreenLayout::xCenter + dash/2, y, 1, Color::Red);
 		  // only draw every 2 labels
-		  if (label % onlyLabelEvery == 0)
-			  // -30 so that the number is left from the dash
-			  // -10 so that the number is vertically center aligned with dash
-			  screen.drawText(dashStart - 30, y-10, "%3d", label);
-		  label += 1;
-	  }
-	  label = 0;
-	  // unter der 0 muessen 15mal beschriftet werden
-	  for (int y=ymax/2; y<=ymax; y+=pixelPerVolt) {
-	  		  int dashStart = xmax/2 - DASHBREITE/2;
-	  		  int dashEnd = xmax/2 + DASHBREITE/2;
-	  		  // draw beschriftung at x=0-haelfte der breite, y
-	  		  screen.drawLine(dashStart, y, dashEnd, y, 1, Color::Red);
-	  		  // only draw every 2 labels and from -15 to +15
-	  		  if (label % onlyLabelEvery == 0 && label <= voltmax && label >= voltmin)
-	  			  // -30 so that the number is left from the dash
-	  			  // -10 so that the number is vertically center aligned with dash
-	  			  screen.drawText(dashStart - 30, y-10, "%3d", label);
-	  		  label -= 1;
+		  int yLabel = y + ScreenLayout::yVoltLabelOffset;
+		  if (tick % onlyLabelEvery == 0 && touches(clip, ScreenLayout::xVoltLabel, yLabel, ScreenLayout::xVoltLabel + labelWidth, yLabel + labelHeight))
+			  drawMilliValue(ScreenLayout::xVoltLabel, yLabel, tick * VoltPerDiv::get(vdiv));
 	  }
 
 	  // ---horizontal axis---
 	  // draw x-achse und Beschriftungen t fuer Zeit
-	  screen.drawLine(0, ymax/2, xmax  , ymax/2, 1, Color::Red ); // horizontal
-
-	  label = 0;
-	  // don't draw 0 again, because the y-axis always did
-	  for (int x=firstLabel; x<=xmax; x+=pixelPerSecond) {
-		  	  int dashStart = ymax/2 - DASHBREITE/2;
-		  	  int dashEnd = ymax/2 + DASHBREITE/2;
-			  // draw beschriftung at y=0-hae
-			  screen.drawLine(x, dashStart, x, dashEnd, 1, Color::Red);
-			  if (label % 8 == 0 && label > 0) {
-				  screen.drawText(x-5, dashStart+15, "%d", label);
-			  }
-			  label += 8;
-	  }
+	  if (touches(clip, 0, ScreenLayout::yCenter, xmax, ScreenLayout::yCenter))
+		  screen.drawLine(0, ScreenLayout::yCenter, xmax, ScreenLayout::yCenter, 1, Color::Red ); // horizontal
 
+	  // don't label 0, because the y-axis is labeled there
+	  for (int i=0; i<ScreenLayout::xTick.size; i++) {
+		  int x = ScreenLayout::xTick[i];
+		  if (touches(clip, x, ScreenLayout::yCenter - dash/2, x, ScreenLayout::yCenter + dash/2))
+			  screen.drawLine(x, ScreenLayout::yCenter - dash/2, x, ScreenLayout::yCenter + dash/2, 1, Color::Red);
+		  int xLabel = x + ScreenLayout::xTimeLabelOffset;
+		  if (i > 0 && touches(clip, xLabel, ScreenLayout::yTimeLabel, xLabel + labelWidth, ScreenLayout::yTimeLabel + labelHeight))
+			  drawMilliValue(xLabel, ScreenLayout::yTimeLabel, i * TimePerDiv::get(tdiv));	// µs -> ms
+	  }
 }
 
+/// area of the time range text, Font_10x20, "time range = 80ms"
+const Trace::Region timeRangeArea = { 10, 10, 10 + 17*10, 10 + 20 };
+
 /// prints value of time range to top left of screen
 void printTimeRange(void)
 {
-	// print time range = 0.1s on top left of screen
-	screen.drawText(10, 10, "time range = %dms", 80);
+	// print time range in ms on top left of screen
+	screen.drawText(timeRangeArea.x0, timeRangeArea.y0, "time range = %dms", ScreenLayout::divX * TimePerDiv::get(tdiv) / 1000);
+}
+
+
+/// sets the sample ranges of all viewports from zoomFactor and zoomCenter
+void updateZoom(void)
+{
+	int zoomSamples = sampleSize / zoomFactor;
+	int zoomFirst = zoomCenter - zoomSamples/2;
+
+	// keep the zoom box inside of the capture
+	if (zoomFirst < 0)
+		zoomFirst = 0;
+	if (zoomFirst + zoomSamples > sampleSize)
+		zoomFirst = sampleSize - zoomSamples;
+	zoomCenter = zoomFirst + zoomSamples/2;
+
+	mainView.setSpan(0, sampleSize);
+	mathView.setSpan(0, sampleSize);
+	overview.setSpan(0, sampleSize);
+	zoomView.setSpan(zoomFirst, zoomSamples);
+	detailView.setSpan(0, zoomWindow.width);
+
+	overview.setOffset(verticalOffset);
+	zoomView.setOffset(verticalOffset);
+	detailView.setOffset(verticalOffset);
+}
+
+/// sets the volts per div of channel A in all windows
+///
+/// references, mask and histogram are drawn into traceWindow, so they follow, too
+/// the screen has to be drawn again
+void setVoltPerDiv(BYTE idx)
+{
+	vdiv = idx;
+	int top = ScreenLayout::mVTop(vdiv);
+	int bottom = ScreenLayout::mVBottom(vdiv);
+
+	traceWindow.mVTop = overviewWindow.mVTop = zoomWindow.mVTop = top;
+	traceWindow.mVBottom = overviewWindow.mVBottom = zoomWindow.mVBottom = bottom;
+	mainView.setRange(top, bottom);
+	overview.setRange(top, bottom);
+	zoomView.setRange(top, bottom);
+	detailView.setRange(top, bottom);
+
+	if (verticalOffset > top) verticalOffset = top;
+	if (verticalOffset < bottom) verticalOffset = bottom;
+	updateZoom();
+}
+
+/// applies all queued gestures to zoom and offset
+///
+/// pinch: zoom factor, swipe: pans the zoom box through the capture,
+/// vertical drag: offset of the traces
+/// returns true if anything changed, the caller renders only once per frame
+bool applyGestures(void)
+{
+	bool changed = false;
+	Gesture::Event event;
+
+	// remainders of the pixel to sample/mV conversion, so slow drags add up
+	static int panRest = 0;
+	static int offsetRest = 0;
+
+	while (gesture.get(event)) {
+		switch (event.type) {
+			case Gesture::Event::ZOOM:
+				for (int i=0; i<event.value && zoomFactor < zoomFactorMax; i++)
+					zoomFactor *= 2;
+				for (int i=0; i>event.value && zoomFactor > 1; i--)
+					zoomFactor /= 2;
+				break;
+			case Gesture::Event::PAN:
+				// dragging to the right shows earlier samples
+				panRest += event.value * (sampleSize / zoomFactor);
+				zoomCenter -= panRest / (int)zoomWindow.width;
+				panRest %= (int)zoomWindow.width;
+				break;
+			case Gesture::Event::OFFSET:
+				// dragging downwards moves the traces downwards
+				offsetRest += event.value * (ScreenLayout::mVTop(vdiv) - ScreenLayout::mVBottom(vdiv));
+				verticalOffset -= offsetRest / (int)zoomWindow.height;
+				offsetRest %= (int)zoomWindow.height;
+				if (verticalOffset > ScreenLayout::mVTop(vdiv)) verticalOffset = ScreenLayout::mVTop(vdiv);
+				if (verticalOffset < ScreenLayout::mVBottom(vdiv)) verticalOffset = ScreenLayout::mVBottom(vdiv);
+				break;
+		}
+		changed = true;
+	}
+	if (changed)
+		updateZoom();
+	return changed;
+}
+
+/// prints the counters of the mask test and the result of the last capture
+void drawMaskCounters(void)
+{
+	if (!mask.isValid()) {
+		screen.drawText(10, 30, "no mask                  ");
+		return;
+	}
+	screen.drawText(10, 30, "tested %d failed %d     ", (int)mask.getTested(), (int)mask.getFailed());
+}
+
+/// draws everything except the capture, depending on the view mode
+void drawFrame(void)
+{
+	if (viewMode == VIEW_SPLIT) {
+		overview.drawFrame(Color::Red);
+		zoomView.drawFrame(Color::Red);
+		screen.drawText(firstLabel, ScreenLayout::yCenter - 10, "zoom x%d %s", zoomFactor,
+		                Interpolator::getName(interpolation));
+	} else if (viewMode == VIEW_SPECTRUM) {
+		// frame with a line every dBPerDiv, 0 dBFS at the top
+		mainView.drawFrame(Color::Red);
+		for (int dB = -dBPerDiv; dB > -Spectrum::DB_RANGE; dB -= dBPerDiv) {
+			int y = Spectrum::toY(traceWindow, dB);
+			screen.drawLine(firstLabel, y, lastLabel, y, 1, Color::DarkGrey);
+			screen.drawText(firstLabel + 4, y + 2, "%d dB", dB / 10);
+		}
+		screen.drawText(ScreenLayout::xCenter + 20, 10, "%s, %d/%d Hz",
+		                Fft::getWindowName(fft.getWindow()),
+		                (int)(1000000UL / samplePeriod / fftSize), (int)(1000000UL / samplePeriod / 2));
+	} else if (viewMode == VIEW_WATERFALL) {
+		waterfall.clear();
+		screen.drawText(ScreenLayout::xCenter + 20, 10, "%s, 0..%d Hz",
+		                Fft::getWindowName(fft.getWindow()), (int)(1000000UL / samplePeriod / 2));
+	} else if (viewMode == VIEW_MATH) {
+		// the grid is the one of channel A, the math channel has its own value per div
+		drawCoordinateSystem();
+		screen.drawText(10, 30, "math %s:", MathChannel::getName(math.getOperation()));
+	} else if (viewMode == VIEW_DECODE) {
+		screen.drawText(ScreenLayout::xCenter + 20, 10, "decoder: %s", Decoder::getName(decoder.getProtocol()));
+	} else if (viewMode == VIEW_MASK) {
+		drawCoordinateSystem();
+		mask.draw(screen, traceWindow, calibration, Color::Green);
+		drawMaskCounters();
+	} else if (viewMode == VIEW_HISTOGRAM) {
+		drawCoordinateSystem();
+	} else {
+		drawCoordinateSystem();
+		drawReferences();
+	}
+}
+
+/// draws the capture into the viewports of the actual view mode
+void drawCapture(void)
+{
+	if (viewMode == VIEW_SPLIT) {
+		overview.draw(pyramid, calibration, Color::Yellow);
+		overview.drawMarker(zoomView, Color::White);
+		if (interpolation != Interpolator::NONE && zoomView.getNumOfSamples() < zoomWindow.width) {
+			detailPyramid.build(interpolator.get(volts, sampleSize, zoomView.getFirst(),
+			                                     zoomView.getNumOfSamples(), zoomWindow.width),
+			                    zoomWindow.width);
+			detailView.draw(detailPyramid, calibration, Color::Yellow);
+		} else {
+			zoomView.draw(pyramid, calibration, Color::Yellow);
+		}
+		decoder.drawAnnotations(screen, zoomView, zoomWindow.y + zoomWindow.height - 24, Color::Cyan);
+	} else if (viewMode == VIEW_SPECTRUM) {
+		spectrum.draw(traceWindow, samplePeriod, Color::Yellow, Color::White);
+	} else if (viewMode == VIEW_MATH) {
+		mainView.draw(pyramid, calibration, Color::Yellow);
+		mathPyramid.build(math.get(volts, voltsB, sampleSize), sampleSize);
+		mathView.draw(mathPyramid, mathCalibration, Color::Magenta);
+		// the scale of the integral depends on the capture, so it is known only now
+		drawMilliValue(10, 50, (int)(math.getRange() * 2 / ScreenLayout::divY));
+		screen.drawText(60, 50, "%s/div", math.getUnit());
+	} else if (viewMode == VIEW_DECODE) {
+		decoder.drawTable(screen, firstLabel, ScreenLayout::yTop, decoder.find(zoomView.getFirst()),
+		                  (ScreenLayout::yBottom - ScreenLayout::yTop) / Decoder::LINE_HEIGHT);
+	} else if (viewMode == VIEW_MASK) {
+		mainView.draw(pyramid, calibration, Color::Yellow);
+		if (mask.isValid() && mask.getFailed() > 0) {
+			// mark the first violating column of the last failed capture
+			int x = firstLabel + mask.getFailedColumn();
+			screen.drawLine(x, ScreenLayout::yTop, x, ScreenLayout::yBottom, 1, Color::Red);
+		}
+	} else if (viewMode == VIEW_HISTOGRAM) {
+		histogram.drawAmplitude(screen, traceWindow, histogramWidth, Color::Yellow, Color::Black);
+		histogram.drawTime(screen, histogramTimeArea, Color::Cyan, Color::Black);
+		histogram.drawStatistics(screen, 10, 30);
+	} else {
+		mainView.draw(pyramid, calibration, Color::Yellow);
+		measure.drawReadout(screen, 10, 30);
+		counter.drawReadout(screen, 10, 30 + 5*Measure::LINE_HEIGHT, counterResult);
+		cursors.draw();
+		cursors.drawReadout(volts, sampleSize);
+	}
+}
+
+/// moves a cursor by touch
+///
+/// only the erased cursor line is repaired (grid, references, time range and trace below it),
+/// then the cursor lines and the readout are drawn again, the trace is not redrawn
+void dragCursors(const Pointer::Data &touchData)
+{
+	Trace::Region erased;
+
+	if (cursors.update(touchData, erased)) {
+		drawCoordinateSystem(&erased);
+		if (touches(&erased, timeRangeArea.x0, timeRangeArea.y0, timeRangeArea.x1, timeRangeArea.y1))
+			printTimeRange();
+		drawReferences(&erased);
+		mainView.redraw(erased, calibration, Color::Yellow);
+		measure.drawReadout(screen, 10, 30);
+		counter.drawReadout(screen, 10, 30 + 5*Measure::LINE_HEIGHT, counterResult);
+		cursors.draw();
+		cursors.drawReadout(volts, sampleSize);
+	}
+}
+
+//-------------------------------------------------------------------
+// remote control with SCPI commands on the terminal and, with CDC, on the virtual COM port
+// voltages are in V, times in s, sent as integer with exponent (NR3), e.g. 1250E-3
+// :WAV:DATA? sends the raw 16 bit codes of the capture (little endian) as binary block,
+// the voltage is YORigin + code * YINCrement
+// :DISP:DATA? sends a PNG of the screen as indefinite length block "#0<png>\n", the PNG
+// ends with its IEND chunk
+enum ScpiCommand {
+	SCPI_RST = 0,
+	SCPI_RUN,
+	SCPI_STOP,
+	SCPI_SINGLE,
+	SCPI_CHAN_SCALE,
+	SCPI_TIM_SCALE,
+	SCPI_TRIG_LEVEL,
+	SCPI_TRIG_SLOPE,
+	SCPI_TRIG_SWEEP,
+	SCPI_MEAS_VMAX,
+	SCPI_MEAS_VMIN,
+	SCPI_MEAS_VPP,
+	SCPI_MEAS_VAVG,
+	SCPI_MEAS_VRMS,
+	SCPI_MEAS_FREQ,
+	SCPI_MEAS_PERIOD,
+	SCPI_MEAS_DUTY,
+	SCPI_MEAS_RISE,
+	SCPI_MEAS_FALL,
+	SCPI_WAV_SOURCE,
+	SCPI_WAV_DATA,
+	SCPI_WAV_POINTS,
+	SCPI_WAV_XINC,
+	SCPI_WAV_YINC,
+	SCPI_WAV_YORIGIN,
+	SCPI_DISP_DATA,
+	SCPI_STREAM
+};
+
+const Scpi::Command scpiCommands[] = {
+	{ "*RST",					SCPI_RST },
+	{ ":RUN",					SCPI_RUN },
+	{ ":STOP",					SCPI_STOP },
+	{ ":SINGle",				SCPI_SINGLE },
+	{ ":CHANnel#:SCALe",		SCPI_CHAN_SCALE },
+	{ ":TIMebase:SCALe",		SCPI_TIM_SCALE },
+	{ ":TRIGger:LEVel",			SCPI_TRIG_LEVEL },
+	{ ":TRIGger:SLOPe",			SCPI_TRIG_SLOPE },
+	{ ":TRIGger:SWEep",			SCPI_TRIG_SWEEP },
+	{ ":MEASure:VMAX",			SCPI_MEAS_VMAX },
+	{ ":MEASure:VMIN",			SCPI_MEAS_VMIN },
+	{ ":MEASure:VPP",			SCPI_MEAS_VPP },
+	{ ":MEASure:VAVerage",		SCPI_MEAS_VAVG },
+	{ ":MEASure:VRMS",			SCPI_MEAS_VRMS },
+	{ ":MEASure:FREQuency",		SCPI_MEAS_FREQ },
+	{ ":MEASure:PERiod",		SCPI_MEAS_PERIOD },
+	{ ":MEASure:DUTYcycle",		SCPI_MEAS_DUTY },
+	{ ":MEASure:RISetime",		SCPI_MEAS_RISE },
+	{ ":MEASure:FALLtime",		SCPI_MEAS_FALL },
+	{ ":WAVeform:SOURce",		SCPI_WAV_SOURCE },
+	{ ":WAVeform:DATA",			SCPI_WAV_DATA },
+	{ ":WAVeform:POINts",		SCPI_WAV_POINTS },
+	{ ":WAVeform:XINCrement",	SCPI_WAV_XINC },
+	{ ":WAVeform:YINCrement",	SCPI_WAV_YINC },
+	{ ":WAVeform:YORigin",		SCPI_WAV_YORIGIN },
+	{ ":DISPlay:DATA",			SCPI_DISP_DATA },
+#if defined(USB_DEVICE_ENABLE) && USE_USB_STREAM == 'C'
+	{ ":STReam",				SCPI_STREAM },	// while the stream is busy, only :STReam OFF is accepted on the virtual COM port
+#endif
+};
+
+// requests of the remote control, handled by the main loop
+bool remoteRun = false;		// take captures continuously (:RUN), else keep the shown one (:STOP)
+bool remoteRestart = false;	// take a new capture
+bool remoteRedraw = false;	// the scale has changed, draw the view again
+BYTE waveSource = 1;		// channel of :WAV:DATA?
+
+/// executes the SCPI commands
+///
+/// only changes the settings or requests actions of the main loop,
+/// so the same handler serves all parsers
+class ScpiHandler : public Scpi::Handler
+{
+public:
+	int onCommand(Scpi &scpi, BYTE id, BYTE suffix, const char *param, bool isQuery)
+	{
+		const Measure::Result &r = measure.get();
+		int value;
+
+		switch (id) {
+			case SCPI_RST:
+				setVoltPerDiv(0);
+				trigger.setSweep(Trigger::FREE);
+				trigger.setSlope(Trigger::RISING);
+				trigger.setLevel(0x8000);
+				waveSource = 1;
+				remoteRun = false;
+				remoteRedraw = true;
+				return Scpi::NO_ERROR;
+
+			case SCPI_RUN:		remoteRun = true;	remoteRestart = true;	return Scpi::NO_ERROR;
+			case SCPI_STOP:		remoteRun = false;							return Scpi::NO_ERROR;
+			case SCPI_SINGLE:	remoteRun = false;	remoteRestart = true;	return Scpi::NO_ERROR;
+
+			case SCPI_CHAN_SCALE:
+				if (suffix != 1)
+					return Scpi::HEADER_SUFFIX;
+				if (isQuery) {
+					scpi.print("%dE-3", VoltPerDiv::get(vdiv));
+					return Scpi::NO_ERROR;
+				}
+				if (!Scpi::getValue(param, value, 3))
+					return Scpi::ILLEGAL_PARAMETER;
+				for (BYTE i=0; i<VoltPerDiv::size; i++) {
+					if (VoltPerDiv::get(i) == value) {
+						setVoltPerDiv(i);
+						remoteRedraw = true;
+						return Scpi::NO_ERROR;
+					}
+				}
+				return Scpi::DATA_OUT_OF_RANGE;
+
+			case SCPI_TIM_SCALE:
+				// the time per div is fixed by the sample period of MyTimer
+				if (isQuery) {
+					scpi.print("%dE-6", TimePerDiv::get(tdiv));
+					return Scpi::NO_ERROR;
+				}
+				if (!Scpi::getValue(param, value, 6))
+					return Scpi::ILLEGAL_PARAMETER;
+				return (value == TimePerDiv::get(tdiv)) ? Scpi::NO_ERROR : Scpi::DATA_OUT_OF_RANGE;
+
+			case SCPI_TRIG_LEVEL:
+				if (isQuery) {
+					scpi.print("%dE-3", calibration.toMilliVolt(trigger.getLevel()));
+					return Scpi::NO_ERROR;
+				}
+				if (!Scpi::getValue(param, value, 3))
+					return Scpi::ILLEGAL_PARAMETER;
+				trigger.setLevel(calibration.toCode(value));
+				return Scpi::NO_ERROR;
+
+			case SCPI_TRIG_SLOPE:
+				if (isQuery) {
+					scpi.print(trigger.getSlope() == Trigger::RISING ? "POS" : "NEG");
+				} else if (Scpi::isMnemonic(param, "POSitive")) {
+					trigger.setSlope(Trigger::RISING);
+				} else if (Scpi::isMnemonic(param, "NEGative")) {
+					trigger.setSlope(Trigger::FALLING);
+				} else {
+					return Scpi::ILLEGAL_PARAMETER;
+				}
+				return Scpi::NO_ERROR;
+
+			case SCPI_TRIG_SWEEP:
+				if (isQuery) {
+					const char *name[] = { "FREE", "AUTO", "NORM" };
+					scpi.print("%s", name[trigger.getSweep()]);
+				} else if (Scpi::isMnemonic(param, "FREE")) {
+					trigger.setSweep(Trigger::FREE);
+				} else if (Scpi::isMnemonic(param, "AUTO")) {
+					trigger.setSweep(Trigger::AUTO);
+				} else if (Scpi::isMnemonic(param, "NORMal")) {
+					trigger.setSweep(Trigger::NORMAL);
+				} else {
+					return Scpi::ILLEGAL_PARAMETER;
+				}
+				return Scpi::NO_ERROR;
+
+			case SCPI_WAV_SOURCE:
+				if (isQuery) {
+					scpi.print("CHAN%d", waveSource);
+				} else if (!Scpi::isMnemonic(param, "CHANnel", &waveSource) || waveSource < 1 || waveSource > 2) {
+					waveSource = 1;
+					return Scpi::ILLEGAL_PARAMETER;
+				}
+				return Scpi::NO_ERROR;
+
+			case SCPI_STREAM:
+				if (isQuery) {
+					scpi.print("%d", stream.isStarted() ? 1 : 0);
+				} else if (Scpi::isMnemonic(param, "ON") || (Scpi::getValue(param, value, 0) && value == 1)) {
+					// a restart would cut the frame being sent
+					if (stream.isBusy())
+						return Scpi::SETTINGS_CONFLICT;
+					stream.start();
+				} else if (Scpi::isMnemonic(param, "OFF") || (Scpi::getValue(param, value, 0) && value == 0)) {
+					stream.stop();
+				} else {
+					return Scpi::ILLEGAL_PARAMETER;
+				}
+				return Scpi::NO_ERROR;
+		}
+
+		// all other commands are queries only
+		if (!isQuery)
+			return Scpi::UNDEFINED_HEADER;
+
+		switch (id) {
+			case SCPI_MEAS_VMAX:	scpi.print("%dE-3", r.maximum);		break;
+			case SCPI_MEAS_VMIN:	scpi.print("%dE-3", r.minimum);		break;
+			case SCPI_MEAS_VPP:		scpi.print("%dE-3", r.peakToPeak);	break;
+			case SCPI_MEAS_VAVG:	scpi.print("%dE-3", r.mean);		break;
+			case SCPI_MEAS_VRMS:	scpi.print("%dE-3", r.rms);			break;
+			case SCPI_MEAS_FREQ:	printTiming(scpi, r.frequency, -3);	break;
+			case SCPI_MEAS_PERIOD:	printTiming(scpi, r.period, -9);	break;
+			case SCPI_MEAS_DUTY:	printTiming(scpi, r.duty, -1);		break;	// %
+			case SCPI_MEAS_RISE:	printTiming(scpi, r.rise, -9);		break;
+			case SCPI_MEAS_FALL:	printTiming(scpi, r.fall, -9);		break;
+
+			case SCPI_WAV_DATA:
+				// directly from the capture, restartMeasurement() waits until the block is sent
+				if (!voltsVoll)
+					return Scpi::DATA_STALE;
+				scpi.sendBlock((const BYTE *)(waveSource == 2 ? voltsB : volts), sampleSize * sizeof(WORD));
+				break;
+
+			case SCPI_WAV_POINTS:	scpi.print("%d", sampleSize);					break;
+			case SCPI_WAV_XINC:		scpi.print("%dE-6", samplePeriod);				break;
+			case SCPI_WAV_YINC:		// fullScale/65536 mV = fullScale*15625/1024 nV
+									scpi.print("%dE-9", (int)((DWORD)calibration.fullScale * 15625 / 1024));	break;
+			case SCPI_WAV_YORIGIN:	scpi.print("%dE-3", calibration.offset);		break;
+
+			case SCPI_DISP_DATA:
+				// encoded row by row while it is sent, one image at a time
+				if (screenshot.isBusy())
+					return Scpi::SETTINGS_CONFLICT;
+				screenshot.start();
+				scpi.sendBlock(screenshot);
+				break;
+		}
+		return Scpi::NO_ERROR;
+	}
+
+private:
+	/// a timing value of 0 was not measurable, SCPI sends NaN
+	void printTiming(Scpi &scpi, DWORD value, int exp)
+	{
+		if (value == 0)
+			scpi.print("9.91E37");
+		else
+			scpi.print("%luE%d", (unsigned long)value, exp);
+	}
+};
+
+const char scpiIdent[] = "EmbSysLib,Oscilloscope Display,0,1.0";
+ScpiHandler scpiHandler;
+
+Scpi scpiTerminal(scpiCommands, sizeof(scpiCommands)/sizeof(Scpi::Command), scpiHandler, uartTx, scpiIdent);
+#if defined(USB_DEVICE_ENABLE) && USE_USB_STREAM == 'C'
+Scpi scpiUsb(scpiCommands, sizeof(scpiCommands)/sizeof(Scpi::Command), scpiHandler, cdcLink, scpiIdent);
+#endif
+
+/// a new capture is started only if no waveform is sent
+bool isWaveformSent(void)
+{
+#if defined(USB_DEVICE_ENABLE) && USE_USB_STREAM == 'C'
+	if (scpiUsb.isBusy())
+		return true;
+#endif
+	return scpiTerminal.isBusy();
 }
 
 
@@ -243,12 +940,17 @@ int main( void )
   screen.setBackColor( Color::Black   );
   screen.clear();
 
-  // Frame
-  drawCoordinateSystem(pixelPerVolt, pixelPerSecond);
+  decoder.setThreshold(logicThreshold);
+  decoder.setBaudrate(uartBaud);
+  interpolator.setMode(interpolation);
 
+#ifdef USB_DEVICE_ENABLE
+  usb.start();
+#endif
 
-  int x = firstLabel; // x is time-axis
-  int y = 0;
+  // Frame
+  updateZoom();
+  drawFrame();
 
   // drawn once is used to indicate if volts array has been already drawn
   // as it only needs to be drawn once until next measurement starts (btnRight -> clicked_next)
@@ -257,34 +959,222 @@ int main( void )
 
   while( 1 )
   {
+#if defined(USE_ADC) && USE_ADC == 'F'
+	  // replay of a capture file as fast as possible: the samples of one capture per loop,
+	  // in the same order on every run, so the processing chain gets identical input
+	  for (WORD i = 0; i < sampleSize; i++)
+		  timer.acquire();
+#endif
+
 	  if (btnRight.getEvent() == Digital::Event::ACTIVATED) {
 		  // start new adc measurement, reset time
 		  restartMeasurement(timer.time);
 		  screen.clear();	// clear old sample from screen
-		  drawCoordinateSystem(pixelPerVolt, pixelPerSecond);
+		  drawFrame();
 		  drawnOnce = false;	// new sample hasn't been drawn yet
 	  }
 
+	  // switch to the next view
+	  if (btnCtrl.getEvent() == Digital::Event::ACTIVATED) {
+		  viewMode = (viewMode + 1) % NUM_OF_VIEWS;
+		  gesture.reset();
+		  screen.clear();
+		  drawFrame();
+		  if (viewMode == VIEW_HISTOGRAM || viewMode == VIEW_WATERFALL) {
+			  // these views are filled continuously, start with a fresh capture
+			  restartMeasurement(timer.time);
+			  drawnOnce = false;
+		  }
+		  if (drawnOnce)
+			  drawCapture();	// same capture, pyramid and FFT are still valid
+	  }
+
+	  // cursors can only be dragged in the full screen view of a shown capture
+	  Pointer::Data touchData = pointer.get();
+	  if (viewMode == VIEW_TRACE && drawnOnce) {
+		  dragCursors(touchData);
+	  }
+
+	  // gestures only change the state, the split screen is rendered once per frame
+	  // and only for a stopped capture
+	  if (viewMode == VIEW_SPLIT && drawnOnce) {
+		  gesture.update(touchData);
+		  if (applyGestures()) {
+			  screen.clear();
+			  drawFrame();
+			  drawCapture();
+		  }
+	  }
+
+	  // remote control, a line is taken only after the previous one is answered completely
+	  if (!scpiTerminal.isBusy()) {
+		  char *line = terminal.getString();
+		  if (line)
+			  scpiTerminal.execute(line);
+	  }
+	  scpiTerminal.update();
+#if defined(USB_DEVICE_ENABLE) && USE_USB_STREAM == 'C'
+	  // the virtual COM port is shared with the stream: while the stream is busy, no
+	  // command may respond, and a frame is passed only while no response is pending
+	  if (stream.isBusy())
+		  scpiUsb.lock(SCPI_STREAM);
+	  else
+		  scpiUsb.unlock();
+	  BYTE c;
+	  while (!scpiUsb.isBusy() && usbUart.get(c))
+		  scpiUsb.put(c);
+	  scpiUsb.update();
+#endif
+
+	  // a restart requested while a waveform was sent
+	  if (restartPending)
+		  restartMeasurement(timer.time);
+
+	  // :RUN replaces the shown capture by the next one, a failed mask test is kept
+	  if (remoteRun && drawnOnce && viewMode != VIEW_MASK)
+		  remoteRestart = true;
+	  if (remoteRestart && !isWaveformSent()) {
+		  remoteRestart = false;
+		  remoteRedraw = false;
+		  restartMeasurement(timer.time);
+		  screen.clear();
+		  drawFrame();
+		  drawnOnce = false;
+	  } else if (remoteRedraw) {
+		  remoteRedraw = false;
+		  screen.clear();
+		  drawFrame();
+		  if (drawnOnce)
+			  drawCapture();
+	  }
+
+#if defined(USB_DEVICE_ENABLE) && USE_USB_STREAM == 'C'
+	  // stream only while the host listens, the blocks are sent as far as the credit of cdcLink allows
+	  switch (usbUart.connection.getUnique()) {
+		  case USB_Uart::DISCONNECTED:
+		  case USB_Uart::USB_DISCONNECTED:	stream.stop();	break;
+		  default:											break;
+	  }
+	  if (!scpiUsb.isBusy())
+		  stream.transmit(cdcLink);
+#endif
+
+	  // the counter runs independent of the capture, its readout is updated after every gate
+	  if (counter.get(counterResult) && viewMode == VIEW_TRACE) {
+		  counter.drawReadout(screen, 10, 30 + 5*Measure::LINE_HEIGHT, counterResult);
+	  }
+
+	  // store the shown sample as golden capture into the next reference slot
+	  // in the spectrum view select the next window function instead
+	  if (btnLeft.getEvent() == Digital::Event::ACTIVATED) {
+		  if (viewMode == VIEW_SPECTRUM) {
+			  fft.setWindow((fft.getWindow() + 1) % Fft::NUM_OF_WINDOWS);
+			  screen.clear();
+			  drawFrame();
+			  if (drawnOnce) {
+				  fft.transform(volts, sampleSize);
+				  drawCapture();
+			  }
+		  } else if (viewMode == VIEW_WATERFALL) {
+			  fft.setWindow((fft.getWindow() + 1) % Fft::NUM_OF_WINDOWS);
+			  screen.clear();
+			  drawFrame();
+		  } else if (viewMode == VIEW_DECODE) {
+			  decoder.setProtocol((decoder.getProtocol() + 1) % Decoder::NUM_OF_PROTOCOLS);
+			  screen.clear();
+			  drawFrame();
+			  if (drawnOnce) {
+				  decoder.decode(volts, voltsB, sampleSize);
+				  drawCapture();
+			  }
+		  } else if (viewMode == VIEW_MASK) {
+			  if (drawnOnce) {
+				  // the shown capture plus tolerance becomes the mask, then screening starts
+				  mask.create(pyramid, sampleSize,
+				              (WORD)((DWORD)maskTolerance * 0x10000 / calibration.fullScale), maskTimeTolerance);
+				  restartMeasurement(timer.time);
+				  screen.clear();
+				  drawFrame();
+				  drawnOnce = false;
+			  }
+		  } else if (viewMode == VIEW_HISTOGRAM) {
+			  histogram.reset();
+			  screen.clear();
+			  drawFrame();
+			  drawCapture();
+		  } else if (viewMode == VIEW_MATH) {
+			  math.setOperation((math.getOperation() + 1) % MathChannel::NUM_OF_OPERATIONS);
+			  screen.clear();
+			  drawFrame();
+			  if (drawnOnce)
+				  drawCapture();
+		  } else if (voltsVoll) {
+			  reference.set(nextReferenceSlot, volts, sampleSize, samplePeriod, calibration);
+			  nextReferenceSlot = (nextReferenceSlot + 1) % Reference::NUM_OF_SLOTS;
+		  }
+	  }
+
 	  /*
 	   * Pixel ausgeben
 	   * Draw all content of volts array
 	   * corresponds to measurement of 1 measurement of volt per 100µs
 	   * 800 * 0.0001 = 0.08s measurement
 	  */
-	  if (voltsVoll && !drawnOnce) {
-    	// draw time range = 0.08s as info
-    	printTimeRange();
+	  if (voltsVoll && !drawnOnce && !restartPending) {
     	// 10^-4 * 1000 = alle 0.08s ist voltsVoll = true
-    	for (int i=0; i<sampleSize; i++) {
-    		// every 100µs 1 value is measured
-    		// so the time difference between 2 values is 100µs
-    		x = i + firstLabel; // offset, start drawing from firstLabel on
-    		y = yCoordFromVolt(volts[i], pixelPerVolt);
-    		screen.drawPixel(x, y, Color::Yellow); // draw corresponding pixel of measured values
+    	// every 100µs 1 value is measured, one value per pixel column
+    	// each column is drawn as one vertical span connected to its neighbour
+    	// the pyramid is built once, every viewport only decimates its own columns
+    	if (filterTable[filterSel]) {
+    		filterTable[filterSel]->reset(volts[0]);
+    		filterTable[filterSel]->process(volts, sampleSize);
+    	}
+    	pyramid.build(volts, sampleSize);
+
+    	// mask test: a passed capture only updates the counters and the next one is taken at once,
+    	// everything else is done for failed captures only
+    	bool screening = (viewMode == VIEW_MASK && mask.isValid());
+    	if (screening && mask.test(pyramid, sampleSize)) {
+    		drawMaskCounters();
+    		restartMeasurement(timer.time);
+    	} else if (viewMode == VIEW_HISTOGRAM) {
+    		// every capture is only added, then the next one is taken at once
+    		Trace::Column range;
+    		pyramid.decimate(0, sampleSize, &range, 1);
+    		histogram.add(volts, sampleSize, range);
+    		drawCapture();
+    		restartMeasurement(timer.time);
+    	} else if (viewMode == VIEW_WATERFALL) {
+    		// one new row per capture, the rows above stay on screen
+    		fft.transform(volts, sampleSize);
+    		waterfall.add(Color::White);
+    		restartMeasurement(timer.time);
+    	} else {
+    		// draw time range = 0.08s as info
+    		printTimeRange();
+    		fft.transform(volts, sampleSize);
+    		// the reference levels of the measurements are taken from min/max of the pyramid
+    		Trace::Column range;
+    		pyramid.decimate(0, sampleSize, &range, 1);
+    		measure.update(volts, sampleSize, range);
+    		math.invalidate();
+    		interpolator.invalidate();
+    		decoder.decode(volts, voltsB, sampleSize);
+    		if (screening) {
+    			screen.clear();
+    			drawFrame();
+    			printTimeRange();
+    		}
+    		drawCapture();
+    		// only draw the volt array once for performance reasons
+    		// the values will stay on screen automatically until new sample is started
+    		drawnOnce = true;
+    		if (screening && !maskStopOnFail) {
+    			// show the failure, but keep on testing
+    			restartMeasurement(timer.time);
+    			drawnOnce = false;
+    		}
     	}
-    	// only draw the volt array once for performance reasons
-    	// the values will stay on screen automatically until new sample is started
-    	drawnOnce = true;
 	  }
 
 	  // Bildschirm aktualisieren